@@ -28,30 +28,62 @@ THE SOFTWARE.
 #include <random>
 #include <stack>
 #include <thread>
+#include <condition_variable>
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <exception>
+#include <numeric>
+#include <stdexcept>
+#include <cstdarg>
+#include <dirent.h>
+#include <sys/mman.h>
 
 #include "TransferBench.hpp"
+#include "Library.hpp"
 #include "GetClosestNumaNode.hpp"
+#include "CpuThreadPool.hpp"
 
-int main(int argc, char **argv)
+// Command-line entry point (main() lives in Client.cpp)
+int CommandLineMain(int argc, char **argv)
 {
   // Check for NUMA library support
   if (numa_available() == -1)
   {
     printf("[ERROR] NUMA library not supported. Check to see if libnuma has been installed on this system\n");
-    exit(1);
+    return 1;
   }
 
+  // Initialize multi-process support (if launched via mpirun / srun), which is finalized on every return path
+  MpInit(&argc, &argv);
+  int const exitCode = RunCommandLineTests(argc, argv);
+  MpFinalize();
+  return exitCode;
+}
+
+int RunCommandLineTests(int argc, char **argv)
+{
   // Display usage instructions and detected topology
   if (argc <= 1)
   {
-    int const outputToCsv = EnvVars::GetEnvVar("OUTPUT_TO_CSV", 0);
+    char const* outputToCsvStr = getenv("OUTPUT_TO_CSV");
+    int const outputToCsv = outputToCsvStr ? atoi(outputToCsvStr) : 0;
     if (!outputToCsv) DisplayUsage(argv[0]);
     DisplayTopology(outputToCsv);
-    exit(0);
+    return 0;
   }
 
   // Collect environment variables / display current run configuration
   EnvVars ev;
+  SelectGpuIndexing(ev.usePcieIndexing);
+
+  // Open structured results file (only rank 0 reports results)
+  if (!ev.resultsFile.empty() && MpRank() == 0)
+    ResultsSink::Get().Open(ev.resultsFile, TB_VERSION, GetTopologyJson(ev));
+
+  // Load previous results to compare against (only rank 0 reports results)
+  if (!ev.baselineFile.empty() && MpRank() == 0)
+    BaselineChecker::Get().Load(ev.baselineFile);
 
   // Determine number of bytes to run per Transfer
   size_t numBytesPerTransfer = argc > 2 ? atoll(argv[2]) : DEFAULT_BYTES_PER_TRANSFER;
@@ -69,7 +101,33 @@ int main(int argc, char **argv)
   if (numBytesPerTransfer % 4)
   {
     printf("[ERROR] numBytesPerTransfer (%lu) must be a multiple of 4\n", numBytesPerTransfer);
-    exit(1);
+    return 1;
+  }
+
+  // Multi-process mode only supports Transfers from a configuration file or the command line
+  if (MpNumRanks() > 1)
+  {
+    bool isCollective = false;
+    for (int i = 0; i < NUM_COLL_TYPES; i++)
+      isCollective |= !strcmp(argv[1], CollTypeName[i]);
+    if (!strcmp(argv[1], "sweep") || !strcmp(argv[1], "rsweep") || !strcmp(argv[1], "p2p") ||
+        !strcmp(argv[1], "scaling") || !strcmp(argv[1], "a2a") || !strcmp(argv[1], "pipeline") ||
+        !strcmp(argv[1], "autotune") || !strcmp(argv[1], "contention") ||
+        !strcmp(argv[1], "healthcheck") || !strcmp(argv[1], "latency") || isCollective)
+    {
+      printf("[ERROR] Preset %s is not supported when running with multiple ranks\n", argv[1]);
+      return 1;
+    }
+    if (ev.numIterations <= 0)
+    {
+      printf("[ERROR] NUM_ITERATIONS must be positive when running with multiple ranks\n");
+      return 1;
+    }
+    if (ev.baselineRetryIterations > 0)
+    {
+      printf("[ERROR] BASELINE_RETRY_ITERS is not supported when running with multiple ranks\n");
+      return 1;
+    }
   }
 
   // Check for preset tests
@@ -79,16 +137,21 @@ int main(int argc, char **argv)
     int numGpuSubExecs = (argc > 3 ? atoi(argv[3]) : 4);
     int numCpuSubExecs = (argc > 4 ? atoi(argv[4]) : 4);
 
+    // Force memory pooling so that sweep buffers are only allocated once
+    if (!ev.useMemPool) printf("[WARN] Sweep presets always enable USE_MEM_POOL\n");
+    ev.useMemPool = 1;
     ev.configMode = CFG_SWEEP;
     RunSweepPreset(ev, numBytesPerTransfer, numGpuSubExecs, numCpuSubExecs, !strcmp(argv[1], "rsweep"));
-    exit(0);
+    ReleasePooledResources();
+    return BaselineChecker::Get().Finalize();
   }
   // - Tests that benchmark peer-to-peer performance
   else if (!strcmp(argv[1], "p2p"))
   {
     ev.configMode = CFG_P2P;
     RunPeerToPeerBenchmarks(ev, numBytesPerTransfer / sizeof(float));
-    exit(0);
+    ReleasePooledResources();
+    return BaselineChecker::Get().Finalize();
   }
   // - Test SubExecutor scaling
   else if (!strcmp(argv[1], "scaling"))
@@ -99,11 +162,12 @@ int main(int argc, char **argv)
     if (exeIndex >= ev.numGpuDevices)
     {
       printf("[ERROR] Cannot execute scaling test with GPU device %d\n", exeIndex);
-      exit(1);
+      return 1;
     }
     ev.configMode = CFG_SCALE;
     RunScalingBenchmark(ev, numBytesPerTransfer / sizeof(float), exeIndex, maxSubExecs);
-    exit(0);
+    ReleasePooledResources();
+    return BaselineChecker::Get().Finalize();
   }
   // - Test all2all benchmark
   else if (!strcmp(argv[1], "a2a"))
@@ -114,15 +178,90 @@ int main(int argc, char **argv)
     ev.useSingleStream = 1;
     ev.configMode = CFG_A2A;
     RunAllToAllBenchmark(ev, numBytesPerTransfer, numSubExecs);
-    exit(0);
+    ReleasePooledResources();
+    return BaselineChecker::Get().Finalize();
+  }
+  // - Collective communication pattern benchmarks
+  else if (!strcmp(argv[1], "allreduce") || !strcmp(argv[1], "reducescatter") ||
+           !strcmp(argv[1], "allgather") || !strcmp(argv[1], "broadcast"))
+  {
+    int numSubExecs = (argc > 3 ? atoi(argv[3]) : 4);
+    CollType collType = COLL_ALLREDUCE;
+    for (int i = 0; i < NUM_COLL_TYPES; i++)
+      if (!strcmp(argv[1], CollTypeName[i])) collType = (CollType)i;
+
+    ev.configMode = CFG_COLL;
+    RunCollectiveBenchmark(ev, numBytesPerTransfer, numSubExecs, collType);
+    ReleasePooledResources();
+    return BaselineChecker::Get().Finalize();
+  }
+  // - Interference between pairs of concurrent peer-to-peer flows
+  else if (!strcmp(argv[1], "contention"))
+  {
+    ev.configMode = CFG_CONTENTION;
+    RunContentionBenchmark(ev, numBytesPerTransfer / sizeof(float));
+    ReleasePooledResources();
+    return BaselineChecker::Get().Finalize();
+  }
+  // - Fast node health check within a time budget
+  else if (!strcmp(argv[1], "healthcheck"))
+  {
+    ev.configMode = CFG_HEALTH;
+    bool const isHealthy = RunHealthcheckPreset(ev, numBytesPerTransfer / sizeof(float));
+    ReleasePooledResources();
+    int const exitCode = BaselineChecker::Get().Finalize();
+    return isHealthy ? exitCode : 2;
+  }
+  // - Load latency / flag round-trip latency between devices
+  else if (!strcmp(argv[1], "latency"))
+  {
+    ev.configMode = CFG_LATENCY;
+    RunLatencyBenchmark(ev, numBytesPerTransfer);
+    ReleasePooledResources();
+    return BaselineChecker::Get().Finalize();
+  }
+  // - Automatic tuning of GFX Transfer parameters per link class
+  else if (!strcmp(argv[1], "autotune"))
+  {
+    int maxSubExecs = 0;
+    if (argc > 3)
+      maxSubExecs = atoi(argv[3]);
+    else if (ev.numGpuDevices > 0)
+      HIP_CALL(hipDeviceGetAttribute(&maxSubExecs, hipDeviceAttributeMultiprocessorCount, RemappedIndex(0, false)));
+    if (maxSubExecs <= 0)
+    {
+      printf("[ERROR] Autotune preset requires a positive max # of SubExecs\n");
+      return 1;
+    }
+    if (numBytesPerTransfer == 0)
+    {
+      printf("[ERROR] Autotune preset requires a non-zero number of bytes\n");
+      return 1;
+    }
+    ev.configMode = CFG_TUNE;
+    RunAutotuneBenchmark(ev, numBytesPerTransfer / sizeof(float), maxSubExecs);
+    ReleasePooledResources();
+    return BaselineChecker::Get().Finalize();
+  }
+  // - Pipelined chunked Transfer benchmark
+  else if (!strcmp(argv[1], "pipeline"))
+  {
+    ev.configMode = CFG_PIPE;
+    RunPipelineBenchmark(ev, numBytesPerTransfer);
+    ReleasePooledResources();
+    return BaselineChecker::Get().Finalize();
   }
   else if (!strcmp(argv[1], "cmdline"))
   {
     // Print environment variables and CSV header
-    ev.DisplayEnvVars();
-    if (ev.outputToCsv)
+    if (MpRank() == 0)
     {
-      printf("Test#,Transfer#,NumBytes,Src,Exe,Dst,CUs,BW(GB/s),Time(ms),SrcAddr,DstAddr\n");
+      ev.DisplayEnvVars();
+      if (ev.outputToCsv)
+      {
+        printf("Test#,Transfer#,NumBytes,Src,Exe,Dst,CUs,BW(GB/s),Time(ms),SrcAddr,DstAddr%s\n",
+               ev.showPercentiles ? ",p50(ms),p90(ms),p99(ms),p99.9(ms),Max(ms),StdDev(ms)" : "");
+      }
     }
 
     // Read Transfer from command line
@@ -134,7 +273,8 @@ int main(int argc, char **argv)
     sprintf(line, "%s", cmdlineTransfer.c_str());
     std::vector<Transfer> transfers;
     ParseTransfers(line, ev.numCpuDevices, ev.numGpuDevices, transfers);
-    if (transfers.empty()) exit(0);
+    ResolveAutoSubExecs(ev, transfers);
+    if (transfers.empty()) return 0;
 
     // If the number of bytes is specified, use it
     if (numBytesPerTransfer != 0)
@@ -156,7 +296,8 @@ int main(int argc, char **argv)
         }
       }
     }
-    exit(0);
+    ReleasePooledResources();
+    return BaselineChecker::Get().Finalize();
   }
 
   // Check that Transfer configuration file can be opened
@@ -165,14 +306,18 @@ int main(int argc, char **argv)
   if (!fp)
   {
     printf("[ERROR] Unable to open transfer configuration file: [%s]\n", argv[1]);
-    exit(1);
+    return 1;
   }
 
   // Print environment variables and CSV header
-  ev.DisplayEnvVars();
-  if (ev.outputToCsv)
+  if (MpRank() == 0)
   {
-    printf("Test#,Transfer#,NumBytes,Src,Exe,Dst,CUs,BW(GB/s),Time(ms),SrcAddr,DstAddr\n");
+    ev.DisplayEnvVars();
+    if (ev.outputToCsv)
+    {
+      printf("Test#,Transfer#,NumBytes,Src,Exe,Dst,CUs,BW(GB/s),Time(ms),SrcAddr,DstAddr%s\n",
+             ev.showPercentiles ? ",p50(ms),p90(ms),p99(ms),p99.9(ms),Max(ms),StdDev(ms)" : "");
+    }
   }
 
   int testNum = 0;
@@ -180,12 +325,13 @@ int main(int argc, char **argv)
   while(fgets(line, MAX_LINE_LEN, fp))
   {
     // Check if line is a comment to be echoed to output (starts with ##)
-    if (!ev.outputToCsv && line[0] == '#' && line[1] == '#') printf("%s", line);
+    if (!ev.outputToCsv && MpRank() == 0 && line[0] == '#' && line[1] == '#') printf("%s", line);
 
     // Parse set of parallel Transfers to execute
     std::vector<Transfer> transfers;
     ParseTransfers(line, ev.numCpuDevices, ev.numGpuDevices, transfers);
     if (transfers.empty()) continue;
+    ResolveAutoSubExecs(ev, transfers);
 
     // If the number of bytes is specified, use it
     if (numBytesPerTransfer != 0)
@@ -210,10 +356,11 @@ int main(int argc, char **argv)
   }
   fclose(fp);
 
-  return 0;
+  ReleasePooledResources();
+  return BaselineChecker::Get().Finalize();
 }
 
-void ExecuteTransfers(EnvVars const& ev,
+bool ExecuteTransfers(EnvVars const& ev,
                       int const testNum,
                       size_t const N,
                       std::vector<Transfer>& transfers,
@@ -221,13 +368,64 @@ void ExecuteTransfers(EnvVars const& ev,
                       double* totalBandwidthCpu)
 {
   int const initOffset = ev.byteOffset / sizeof(float);
+  int const rank       = MpRank();
+  int const numRanks   = MpNumRanks();
+
+  // Only rank 0 reports results
+  verbose &= (rank == 0);
+
+  // Set when a suspected regression against the baseline should be confirmed by re-running this Test
+  bool rerunTest = false;
+
+  // Looping Transfers re-launch themselves individually until every other Transfer has completed
+  bool hasLoopingTransfers = false;
+  for (Transfer const& transfer : transfers)
+    hasLoopingTransfers |= transfer.isLooping;
+  if (hasLoopingTransfers)
+  {
+    if (ev.useAsyncLaunch || numRanks > 1)
+    {
+      InputError("Looping Transfers are not supported with USE_ASYNC_LAUNCH or multiple ranks");
+    }
+    for (Transfer const& transfer : transfers)
+    {
+      if (transfer.isLooping && transfer.exeType == EXE_GPU_GFX && ev.useSingleStream)
+      {
+        InputError("Looping GFX Transfers require USE_SINGLE_STREAM=0");
+      }
+    }
+  }
+
+  // Background loads only cover GPUs of the local rank
+  if (ev.bgLoad && numRanks > 1)
+  {
+    InputError("BG_LOAD is not supported with multiple ranks");
+  }
+
+  // Explicit SDMA engines are only used when DMA Transfers are executed via HSA
+  for (int i = 0; i < transfers.size(); i++)
+  {
+    if (transfers[i].exeSubIndex != -1 && !ev.useHsaDma)
+    {
+      InputError("Transfer %d selects an SDMA engine, which requires USE_HSA_DMA=1", i);
+    }
+  }
+
+  // Tests using managed memory also report the cold first iteration, which includes the cost of page migration
+  bool usesManagedMemory = false;
+  for (Transfer const& transfer : transfers)
+  {
+    for (MemType memType : transfer.srcType) usesManagedMemory |= (memType == MEM_MANAGED);
+    for (MemType memType : transfer.dstType) usesManagedMemory |= (memType == MEM_MANAGED);
+  }
 
-  // Map transfers by executor
+  // Map transfers by executor (only those executed by this rank)
   TransferMap transferMap;
   for (int i = 0; i < transfers.size(); i++)
   {
     Transfer& transfer = transfers[i];
     transfer.transferIndex = i;
+    if (transfer.exeRank != rank) continue;
     Executor executor(transfer.exeType, transfer.exeIndex);
     ExecutorInfo& executorInfo = transferMap[executor];
     executorInfo.transfers.push_back(&transfer);
@@ -243,7 +441,9 @@ void ExecuteTransfers(EnvVars const& ev,
     int     const exeIndex   = RemappedIndex(executor.second, IsCpuType(exeType));
 
     exeInfo.totalTime = 0.0;
+    exeInfo.latencyHistogram.Clear();
     exeInfo.totalSubExecs = 0;
+    exeInfo.numSubExecSlots = 0;
 
     // Loop over each transfer this executor is involved in
     for (Transfer* transfer : exeInfo.transfers)
@@ -258,11 +458,14 @@ void ExecuteTransfers(EnvVars const& ev,
         MemType const& srcType  = transfer->srcType[iSrc];
         int     const  srcIndex    = RemappedIndex(transfer->srcIndex[iSrc], IsCpuType(srcType));
 
+        // Memory owned by other ranks is mapped in ExchangeRemoteMemory
+        if (transfer->SrcRank(iSrc) != rank) continue;
+
         // Ensure executing GPU can access source memory
         if (IsGpuType(exeType) && IsGpuType(srcType) && srcIndex != exeIndex)
           EnablePeerAccess(exeIndex, srcIndex);
 
-        AllocateMemory(srcType, srcIndex, transfer->numBytesActual + ev.byteOffset, (void**)&transfer->srcMem[iSrc]);
+        AcquireMemory(ev, srcType, srcIndex, transfer->numBytesActual + ev.byteOffset, (void**)&transfer->srcMem[iSrc]);
       }
 
       // Allocate destination memory
@@ -272,17 +475,31 @@ void ExecuteTransfers(EnvVars const& ev,
         MemType const& dstType  = transfer->dstType[iDst];
         int     const  dstIndex    = RemappedIndex(transfer->dstIndex[iDst], IsCpuType(dstType));
 
+        // Memory owned by other ranks is mapped in ExchangeRemoteMemory
+        if (transfer->DstRank(iDst) != rank) continue;
+
         // Ensure executing GPU can access destination memory
         if (IsGpuType(exeType) && IsGpuType(dstType) && dstIndex != exeIndex)
           EnablePeerAccess(exeIndex, dstIndex);
 
-        AllocateMemory(dstType, dstIndex, transfer->numBytesActual + ev.byteOffset, (void**)&transfer->dstMem[iDst]);
+        AcquireMemory(ev, dstType, dstIndex, transfer->numBytesActual + ev.byteOffset, (void**)&transfer->dstMem[iDst]);
       }
 
+      transfer->subExecOffset = exeInfo.totalSubExecs;
       exeInfo.totalSubExecs += transfer->numSubExecs;
       transferList[transfer->transferIndex] = transfer;
     }
 
+    // Make sure enough pinned worker threads are running before any timing occurs
+    if (exeType == EXE_CPU && ev.useCpuThreadPool)
+    {
+      CpuThreadPool& threadPool = GetCpuThreadPool(ev, exeIndex);
+      if (exeInfo.totalSubExecs > threadPool.NumCores())
+        printf("[WARN] %d CPU subExecutors on NUMA node %d exceed its %d core(s).  Workers will share cores\n",
+               exeInfo.totalSubExecs, exeIndex, threadPool.NumCores());
+      threadPool.Reserve(exeInfo.totalSubExecs);
+    }
+
     // Prepare additional requirement for GPU-based executors
     if (IsGpuType(exeType))
     {
@@ -290,40 +507,59 @@ void ExecuteTransfers(EnvVars const& ev,
 
       // Single-stream is only supported for GFX-based executors
       int const numStreamsToUse = (exeType == EXE_GPU_DMA || !ev.useSingleStream) ? exeInfo.transfers.size() : 1;
-      exeInfo.streams.resize(numStreamsToUse);
-      exeInfo.startEvents.resize(numStreamsToUse);
-      exeInfo.stopEvents.resize(numStreamsToUse);
-      for (int i = 0; i < numStreamsToUse; ++i)
+      AcquireStreams(ev, exeIndex, numStreamsToUse, exeInfo);
+
+      // DMA Transfers executed via HSA are assigned their own SDMA engine(s), rotating through available engines
+      if (exeType == EXE_GPU_DMA && ev.useHsaDma)
       {
-        if (ev.cuMask.size())
-        {
-#if !defined(__NVCC__)
-          HIP_CALL(hipExtStreamCreateWithCUMask(&exeInfo.streams[i], ev.cuMask.size(), ev.cuMask.data()));
-#endif
-        }
-        else
-        {
-          HIP_CALL(hipStreamCreate(&exeInfo.streams[i]));
-        }
-        HIP_CALL(hipEventCreate(&exeInfo.startEvents[i]));
-        HIP_CALL(hipEventCreate(&exeInfo.stopEvents[i]));
+        int nextEngine = 0;
+        for (Transfer* transfer : exeInfo.transfers)
+          PrepareHsaDmaTransfer(*transfer, nextEngine);
       }
 
       if (exeType == EXE_GPU_GFX)
       {
+        // With wavefront granularity, parameters are padded to fill whole threadblocks
+        // (per Transfer, unless all Transfers are launched together in a single stream)
+        int const subExecsPerBlock = ev.useWaveSubExec ? ev.blockSize / WARP_SIZE : 1;
+        if (ev.useSingleStream)
+          exeInfo.numSubExecSlots = RoundUp(exeInfo.totalSubExecs, subExecsPerBlock);
+        else
+        {
+          exeInfo.numSubExecSlots = 0;
+          for (Transfer* transfer : exeInfo.transfers)
+            exeInfo.numSubExecSlots += RoundUp(transfer->numSubExecs, subExecsPerBlock);
+        }
+
         // Allocate one contiguous chunk of GPU memory for threadblock parameters
         // This allows support for executing one transfer per stream, or all transfers in a single stream
+        // When launching asynchronously, each iteration of a batch gets its own copy of the parameters
+        size_t const numParamBytes = exeInfo.numSubExecSlots * sizeof(SubExecParam) * NumParamSlices(ev);
 #if !defined(__NVCC__)
-        AllocateMemory(MEM_GPU, exeIndex, exeInfo.totalSubExecs * sizeof(SubExecParam),
-                       (void**)&exeInfo.subExecParamGpu);
+        AcquireMemory(ev, MEM_GPU, exeIndex, numParamBytes, (void**)&exeInfo.subExecParamGpu);
 #else
-        AllocateMemory(MEM_CPU, exeIndex, exeInfo.totalSubExecs * sizeof(SubExecParam),
-                       (void**)&exeInfo.subExecParamGpu);
+        AcquireMemory(ev, MEM_CPU, exeIndex, numParamBytes, (void**)&exeInfo.subExecParamGpu);
 #endif
+
+        // The work-stealing kernel needs a pair of counters per Transfer (reset by the kernel after each launch)
+        if (ev.gpuKernel == GPU_KERNEL_STEAL)
+        {
+          size_t const numCounterBytes = exeInfo.transfers.size() * 2 * sizeof(unsigned long long);
+#if !defined(__NVCC__)
+          AcquireMemory(ev, MEM_GPU, exeIndex, numCounterBytes, (void**)&exeInfo.chunkCountersGpu);
+#else
+          AcquireMemory(ev, MEM_CPU, exeIndex, numCounterBytes, (void**)&exeInfo.chunkCountersGpu);
+#endif
+          HIP_CALL(hipMemset(exeInfo.chunkCountersGpu, 0, numCounterBytes));
+        }
       }
     }
   }
 
+  // Share memory that is owned by a different rank than the one executing the Transfer
+  std::vector<std::tuple<MemType, float*, size_t>> exportedMem;
+  if (numRanks > 1) ExchangeRemoteMemory(ev, N, transfers, exportedMem);
+
   if (verbose && !ev.outputToCsv) printf("Test %d:\n", testNum);
 
   // Prepare input memory and block parameters for current N
@@ -342,6 +578,7 @@ void ExecuteTransfers(EnvVars const& ev,
       Transfer* transfer = exeInfo.transfers[i];
       transfer->PrepareSubExecParams(ev);
       isSrcCorrect &= transfer->PrepareSrc(ev);
+      PrefetchManagedMemory(ev, *transfer);
       exeInfo.totalBytes += transfer->numBytesActual;
     }
 
@@ -350,6 +587,19 @@ void ExecuteTransfers(EnvVars const& ev,
     {
       std::vector<SubExecParam> tempSubExecParam;
 
+      // SubExecutors of the same Transfer share its chunk counters
+      if (ev.gpuKernel == GPU_KERNEL_STEAL)
+      {
+        for (int i = 0; i < exeInfo.transfers.size(); i++)
+          for (SubExecParam& p : exeInfo.transfers[i]->subExecParam)
+            p.chunkCounter = exeInfo.chunkCountersGpu + 2 * i;
+      }
+
+      // Empty parameters used to pad out partially-filled threadblocks (wavefront granularity)
+      int const subExecsPerBlock = ev.useWaveSubExec ? ev.blockSize / WARP_SIZE : 1;
+      SubExecParam paddingParam = {};
+      paddingParam.preferredXccId = -1;
+
       if (!ev.useSingleStream || (ev.blockOrder == ORDER_SEQUENTIAL))
       {
         // Assign Transfers to sequentual threadblocks
@@ -364,7 +614,11 @@ void ExecuteTransfers(EnvVars const& ev,
             transfer->subExecIdx.push_back(transferOffset + subExecIdx);
             tempSubExecParam.push_back(transfer->subExecParam[subExecIdx]);
           }
-          transferOffset += transfer->numSubExecs;
+
+          // Each Transfer is launched separately, so needs to start on a threadblock boundary
+          if (!ev.useSingleStream)
+            tempSubExecParam.resize(RoundUp(tempSubExecParam.size(), subExecsPerBlock), paddingParam);
+          transferOffset = tempSubExecParam.size();
         }
       }
       else if (ev.blockOrder == ORDER_INTERLEAVED)
@@ -406,6 +660,13 @@ void ExecuteTransfers(EnvVars const& ev,
         }
       }
 
+      tempSubExecParam.resize(exeInfo.numSubExecSlots, paddingParam);
+
+      // Replicate parameters on the host so that all slices are filled by a single copy
+      std::vector<SubExecParam> const sliceParams(tempSubExecParam);
+      for (int slice = 1; slice < NumParamSlices(ev); slice++)
+        tempSubExecParam.insert(tempSubExecParam.end(), sliceParams.begin(), sliceParams.end());
+
       HIP_CALL(hipSetDevice(exeIndex));
       HIP_CALL(hipMemcpy(exeInfo.subExecParamGpu,
                          tempSubExecParam.data(),
@@ -413,13 +674,128 @@ void ExecuteTransfers(EnvVars const& ev,
                          hipMemcpyDefault));
       HIP_CALL(hipDeviceSynchronize());
     }
+
+    // Capture launches into graphs once all parameters are in place
+    if (ev.useHipGraph && IsGpuType(exeType))
+      CaptureGraphs(ev, exeType, exeIndex, exeInfo);
   }
+  if (numRanks > 1) isSrcCorrect = MpAll(isSrcCorrect);
+  bool isValid = isSrcCorrect;
 
   // Launch kernels (warmup iterations are not counted)
   double totalCpuTime = 0;
+  double coldCpuTime  = -1.0;
   size_t numTimedIterations = 0;
-  std::stack<std::thread> threads;
-  for (int iteration = -ev.numWarmups; isSrcCorrect; iteration++)
+  int numIterationsPerLaunch = 1;
+
+  // Executor threads follow the error handling (and use the pool) of this thread.  The first error raised on any of
+  // them is rethrown here once all of them have finished (looping Transfers are released from waiting on it)
+  bool const throwExeInputErrors = throwInputErrors;
+  bool const throwExeRunErrors   = throwRunErrors;
+  MemPool*   exeMemPool          = &GetMemPool();
+  std::exception_ptr exeError;
+  std::mutex         exeErrorMutex;
+
+  // Executor threads are launched once and kept for all iterations of the Test (warmups included), so that thread
+  // creation is not part of the timed iterations.  Each iteration hands every thread one job and waits for all of them
+  struct ExecutorThread
+  {
+    std::thread             thread;
+    std::mutex              mutex;
+    std::condition_variable cv;
+    std::function<void()>   job;          // Empty when idle
+    bool                    quit = false;
+  };
+  struct ExecutorThreads
+  {
+    std::vector<std::unique_ptr<ExecutorThread>> list;
+    ~ExecutorThreads()
+    {
+      for (auto& exeThread : list)
+      {
+        {
+          std::lock_guard<std::mutex> lock(exeThread->mutex);
+          exeThread->quit = true;
+        }
+        exeThread->cv.notify_all();
+        exeThread->thread.join();
+      }
+    }
+  } exeThreads;
+  size_t numExeJobs = 0;
+
+  auto launchExecutorThread = [&](std::function<void()> run, std::atomic<int>* numPending)
+  {
+    if (numExeJobs == exeThreads.list.size())
+    {
+      exeThreads.list.emplace_back(new ExecutorThread);
+      ExecutorThread* exeThread = exeThreads.list.back().get();
+      exeThread->thread = std::thread([=]()
+      {
+        throwInputErrors = throwExeInputErrors;
+        throwRunErrors   = throwExeRunErrors;
+        UseMemPool(exeMemPool);
+
+        std::unique_lock<std::mutex> lock(exeThread->mutex);
+        while (true)
+        {
+          exeThread->cv.wait(lock, [&]{ return exeThread->job || exeThread->quit; });
+          if (exeThread->quit) break;
+          lock.unlock();
+          exeThread->job();
+          lock.lock();
+          exeThread->job = nullptr;
+          exeThread->cv.notify_all();
+        }
+      });
+    }
+
+    ExecutorThread* exeThread = exeThreads.list[numExeJobs++].get();
+    {
+      std::lock_guard<std::mutex> lock(exeThread->mutex);
+      exeThread->job = [&, run, numPending]()
+      {
+        try
+        {
+          run();
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock(exeErrorMutex);
+          if (!exeError) exeError = std::current_exception();
+          if (numPending) numPending->store(0);
+        }
+      };
+    }
+    exeThread->cv.notify_all();
+  };
+
+  // Sliding-window sampling tracks the state of each Transfer at the start of the current window
+  // The sample file (if any) is opened before the background loads are started, and closed once the Test completes
+  std::map<int, double> windowStartTimes;
+  double windowStartSec   = 0;
+  size_t windowStartIters = 0;
+  int    numWindows       = 0;
+  std::unique_ptr<FILE, int(*)(FILE*)> sampleFp(ev.sampleWindowMs > 0 ? OpenSampleFile(ev) : NULL, &fclose);
+
+  // Background loads (BG_LOAD) keep running on every GPU executor's device until all iterations have completed
+  // Each GPU's solo throughput is measured before any of the loads are started
+  // NOTE: No null-stream work may be issued on these devices until the loads are stopped (see StartBackgroundLoad).
+  //       Validation uses a non-blocking stream per device, so ALWAYS_VALIDATE may run while the loads are active
+  std::map<int, BackgroundLoad> backgroundLoads;
+  std::map<int, double>         backgroundThroughput;
+  if (ev.bgLoad && isSrcCorrect)
+  {
+    for (auto const& exeInfoPair : transferMap)
+      if (IsGpuType(exeInfoPair.first.first))
+        backgroundLoads[exeInfoPair.first.second];
+    for (auto& loadPair : backgroundLoads)
+      GetSoloBackgroundThroughput(ev, RemappedIndex(loadPair.first, false));
+    for (auto& loadPair : backgroundLoads)
+      StartBackgroundLoad(ev, RemappedIndex(loadPair.first, false), loadPair.second);
+  }
+
+  for (int iteration = -ev.numWarmups; isSrcCorrect; iteration += numIterationsPerLaunch)
   {
     if (ev.numIterations > 0 && iteration    >= ev.numIterations) break;
     if (ev.numIterations < 0 && totalCpuTime > -ev.numIterations) break;
@@ -429,8 +805,9 @@ void ExecuteTransfers(EnvVars const& ev,
     {
       printf("Memory prepared:\n");
 
-      for (Transfer& transfer : transfers)
+      for (auto transferPair : transferList)
       {
+        Transfer const& transfer = *transferPair.second;
         printf("Transfer %03d:\n", transfer.transferIndex);
         for (int iSrc = 0; iSrc < transfer.numSrcs; ++iSrc)
           printf("  SRC %0d: %p\n", iSrc, transfer.srcMem[iSrc]);
@@ -440,15 +817,25 @@ void ExecuteTransfers(EnvVars const& ev,
       printf("Hit <Enter> to continue: ");
       if (scanf("%*c") != 0)
       {
-        printf("[ERROR] Unexpected input\n");
-        exit(1);
+        RunError("Unexpected input");
       }
       printf("\n");
     }
 
+    // In async launch mode, all warmup iterations are enqueued together, followed by all timed iterations
+    numIterationsPerLaunch = (!ev.useAsyncLaunch ? 1 : (iteration < 0 ? -iteration : ev.numIterations));
+
+    // Start iterations on all ranks together
+    if (numRanks > 1) MpBarrier();
+
     // Start CPU timing for this iteration
     auto cpuStart = std::chrono::high_resolution_clock::now();
 
+    // Number of Transfers that have not yet completed their first pass during this iteration.  Passes that looping
+    // Transfers finish after the last of them has completed are not part of the iteration's CPU time
+    std::atomic<int> numPending(transferList.size());
+    auto pendingDoneTime = cpuStart;
+
     // Execute all Transfers in parallel
     for (auto& exeInfoPair : transferMap)
     {
@@ -457,45 +844,86 @@ void ExecuteTransfers(EnvVars const& ev,
       int const numTransfersToRun = (exeType == EXE_GPU_GFX && ev.useSingleStream) ? 1 : exeInfo.transfers.size();
 
       for (int i = 0; i < numTransfersToRun; ++i)
-        threads.push(std::thread(RunTransfer, std::ref(ev), iteration, std::ref(exeInfo), i));
+      {
+        if (ev.useAsyncLaunch)
+          launchExecutorThread(std::bind(RunTransferAsync, std::ref(ev), iteration, numIterationsPerLaunch,
+                                         std::ref(exeInfo), i), nullptr);
+        else
+          launchExecutorThread(std::bind(RunTransfer, std::ref(ev), iteration, std::ref(exeInfo), i,
+                                         hasLoopingTransfers ? &numPending : nullptr, &pendingDoneTime),
+                               hasLoopingTransfers ? &numPending : nullptr);
+      }
     }
 
     // Wait for all threads to finish
-    int const numTransfers = threads.size();
-    for (int i = 0; i < numTransfers; i++)
+    for (size_t i = 0; i < numExeJobs; i++)
+    {
+      ExecutorThread* exeThread = exeThreads.list[i].get();
+      std::unique_lock<std::mutex> lock(exeThread->mutex);
+      exeThread->cv.wait(lock, [&]{ return !exeThread->job; });
+    }
+    numExeJobs = 0;
+
+    // Background loads would otherwise keep running after the error has been passed on
+    if (exeError)
     {
-      threads.top().join();
-      threads.pop();
+      for (auto& loadPair : backgroundLoads)
+        StopBackgroundLoad(ev, loadPair.second);
+      std::rethrow_exception(exeError);
     }
 
     // Stop CPU timing for this iteration
-    auto cpuDelta = std::chrono::high_resolution_clock::now() - cpuStart;
+    auto cpuDelta = (hasLoopingTransfers ? pendingDoneTime : std::chrono::high_resolution_clock::now()) - cpuStart;
     double deltaSec = std::chrono::duration_cast<std::chrono::duration<double>>(cpuDelta).count();
+    if (iteration == -ev.numWarmups && numIterationsPerLaunch == 1) coldCpuTime = deltaSec * 1000.0;
 
     if (ev.alwaysValidate)
     {
+      bool isDstCorrect = true;
       for (auto transferPair : transferList)
       {
         Transfer* transfer = transferPair.second;
-        transfer->ValidateDst(ev);
+        isDstCorrect &= transfer->ValidateDst(ev);
       }
+      isValid &= CheckDstCorrect(ev, isDstCorrect);
     }
 
     if (iteration >= 0)
     {
-      ++numTimedIterations;
+      numTimedIterations += numIterationsPerLaunch;
       totalCpuTime += deltaSec;
+
+      // Report bandwidth achieved during each window of timed iterations
+      if (ev.sampleWindowMs > 0 && (totalCpuTime - windowStartSec) * 1000.0 >= ev.sampleWindowMs)
+      {
+        ReportSampleWindow(ev, sampleFp.get(), testNum, numWindows++, windowStartSec, totalCpuTime,
+                           numTimedIterations - windowStartIters, transferList, windowStartTimes, verbose);
+        windowStartSec   = totalCpuTime;
+        windowStartIters = numTimedIterations;
+        for (auto transferPair : transferList)
+          windowStartTimes[transferPair.first] = transferPair.second->transferTime;
+      }
     }
   }
 
+  for (auto& loadPair : backgroundLoads)
+    backgroundThroughput[loadPair.first] = StopBackgroundLoad(ev, loadPair.second);
+
+  // Report any final partial window
+  if (ev.sampleWindowMs > 0 && numTimedIterations > windowStartIters)
+  {
+    ReportSampleWindow(ev, sampleFp.get(), testNum, numWindows++, windowStartSec, totalCpuTime,
+                       numTimedIterations - windowStartIters, transferList, windowStartTimes, verbose);
+  }
+  sampleFp.reset();
+
   // Pause for interactive mode
   if (verbose && isSrcCorrect && ev.useInteractive)
   {
     printf("Transfers complete. Hit <Enter> to continue: ");
     if (scanf("%*c") != 0)
     {
-      printf("[ERROR] Unexpected input\n");
-      exit(1);
+      RunError("Unexpected input");
     }
     printf("\n");
   }
@@ -503,13 +931,26 @@ void ExecuteTransfers(EnvVars const& ev,
   // Validate that each transfer has transferred correctly
   size_t totalBytesTransferred = 0;
   int const numTransfers = transferList.size();
+  bool isDstCorrect = true;
   for (auto transferPair : transferList)
   {
     Transfer* transfer = transferPair.second;
-    transfer->ValidateDst(ev);
+    isDstCorrect &= transfer->ValidateDst(ev);
     totalBytesTransferred += transfer->numBytesActual;
+
+    // Collect hardware counters accumulated over timed iterations, reported per iteration (none may have completed
+    // when a time-limited run expires during warmup)
+    transfer->gpuCounters = GpuCountersTake(transfer);
+    for (auto& counter : transfer->gpuCounters)
+      counter.second = numTimedIterations ? counter.second / numTimedIterations : 0.0;
   }
 
+  isValid &= CheckDstCorrect(ev, isDstCorrect);
+
+  // Record how many timed iterations transferTime covers (a baseline retry may run a different number)
+  for (Transfer& transfer : transfers)
+    transfer.numTimedIterations = numTimedIterations;
+
   // Report timings
   totalCpuTime = totalCpuTime / (1.0 * numTimedIterations) * 1000;
   double totalBandwidthGbs = (totalBytesTransferred / 1.0E6) / totalCpuTime;
@@ -518,7 +959,84 @@ void ExecuteTransfers(EnvVars const& ev,
   double maxGpuTime = 0;
 
   if (!isSrcCorrect) goto cleanup;
-  if (ev.useSingleStream)
+  if (numRanks > 1)
+  {
+    // Collect timing for Transfers executed by all ranks, so that rank 0 can report all of them
+    std::vector<double> transferTimes(transfers.size(), 0.0);
+    for (auto transferPair : transferList)
+      transferTimes[transferPair.first] = transferPair.second->transferTime;
+    MpSum(transferTimes.data(), transferTimes.size());
+
+    // Latency statistics and addresses are only known by the rank executing each Transfer, with all other ranks
+    // contributing zeros to the sums
+    std::vector<double> latencyStats(transfers.size() * NUM_LATENCY_STATS, 0.0);
+    std::vector<size_t> addrOffsets(transfers.size() + 1, 0);
+    for (Transfer const& transfer : transfers)
+      addrOffsets[transfer.transferIndex + 1] = transfer.numSrcs + transfer.numDsts;
+    for (size_t i = 0; i < transfers.size(); i++)
+      addrOffsets[i + 1] += addrOffsets[i];
+    std::vector<uint64_t> memAddrs(addrOffsets.back(), 0);
+    for (auto transferPair : transferList)
+    {
+      Transfer const* transfer = transferPair.second;
+      if (ev.showPercentiles)
+        GetLatencyStats(transfer->latencyHistogram, &latencyStats[transferPair.first * NUM_LATENCY_STATS]);
+      uint64_t* addrs = &memAddrs[addrOffsets[transferPair.first]];
+      for (int i = 0; i < transfer->numSrcs; i++) *addrs++ = (uint64_t)(transfer->srcMem[i] + initOffset);
+      for (int i = 0; i < transfer->numDsts; i++) *addrs++ = (uint64_t)(transfer->dstMem[i] + initOffset);
+    }
+    if (ev.showPercentiles) MpSum(latencyStats.data(), latencyStats.size());
+    if (ev.outputToCsv) MpSum(memAddrs.data(), memAddrs.size());
+
+    totalCpuTime = MpMax(totalCpuTime);
+    coldCpuTime  = MpMax(coldCpuTime);
+    totalBytesTransferred = 0;
+    for (Transfer& transfer : transfers)
+    {
+      transfer.numBytesActual = (transfer.numBytes ? transfer.numBytes : N * sizeof(float));
+      transfer.transferTime   = transferTimes[transfer.transferIndex];
+      totalBytesTransferred  += transfer.numBytesActual;
+
+      double transferDurationMsec = transfer.transferTime / (1.0 * numTimedIterations);
+      double transferBandwidthGbs = (transfer.numBytesActual / 1.0E9) / transferDurationMsec * 1000.0f;
+      maxGpuTime = std::max(maxGpuTime, transferDurationMsec);
+      if (!verbose) continue;
+      double const* stats = &latencyStats[transfer.transferIndex * NUM_LATENCY_STATS];
+      if (!ev.outputToCsv)
+      {
+        printf(" Transfer %02d      | %7.3f GB/s | %8.3f ms | %12lu bytes | %s -> %s%02d@%d:%03d -> %s\n",
+               transfer.transferIndex,
+               transferBandwidthGbs, transferDurationMsec,
+               transfer.numBytesActual,
+               transfer.SrcToStr().c_str(),
+               ExeTypeName[transfer.exeType], transfer.exeIndex, transfer.exeRank,
+               transfer.numSubExecs,
+               transfer.DstToStr().c_str());
+        if (ev.showPercentiles) PrintLatencyStatValues(stats);
+      }
+      else
+      {
+        uint64_t const* addrs = &memAddrs[addrOffsets[transfer.transferIndex]];
+        std::vector<float*> srcAddrs(transfer.numSrcs), dstAddrs(transfer.numDsts);
+        for (int i = 0; i < transfer.numSrcs; i++) srcAddrs[i] = (float*)*addrs++;
+        for (int i = 0; i < transfer.numDsts; i++) dstAddrs[i] = (float*)*addrs++;
+
+        printf("%d,%d,%lu,%s,%s%02d@%d,%s,%d,%.3f,%.3f,%s,%s%s\n",
+               testNum, transfer.transferIndex, transfer.numBytesActual,
+               transfer.SrcToStr().c_str(),
+               ExeTypeName[transfer.exeType], transfer.exeIndex, transfer.exeRank,
+               transfer.DstToStr().c_str(),
+               transfer.numSubExecs,
+               transferBandwidthGbs, transferDurationMsec,
+               PtrVectorToStr(srcAddrs, 0).c_str(),
+               PtrVectorToStr(dstAddrs, 0).c_str(),
+               LatencyStatValuesCsv(ev, stats).c_str());
+      }
+    }
+    totalBandwidthGbs = (totalBytesTransferred / 1.0E6) / totalCpuTime;
+    if (totalBandwidthCpu) *totalBandwidthCpu = totalBandwidthGbs;
+  }
+  else if (ev.useSingleStream)
   {
     for (auto& exeInfoPair : transferMap)
     {
@@ -526,12 +1044,17 @@ void ExecuteTransfers(EnvVars const& ev,
       ExeType const exeType  = exeInfoPair.first.first;
       int     const exeIndex = exeInfoPair.first.second;
 
-      // Compute total time for non GPU executors
-      if (exeType != EXE_GPU_GFX)
+      // Compute total time for non GPU executors.  These have no executor-level timing of their own, so their
+      // latency histogram is an aggregate of the samples of every Transfer (on separate streams / threads)
+      bool const isMergedHistogram = (exeType != EXE_GPU_GFX);
+      if (isMergedHistogram)
       {
         exeInfo.totalTime = 0;
         for (auto const& transfer : exeInfo.transfers)
+        {
           exeInfo.totalTime = std::max(exeInfo.totalTime, transfer->transferTime);
+          exeInfo.latencyHistogram.Merge(transfer->latencyHistogram);
+        }
       }
 
       double exeDurationMsec = exeInfo.totalTime / (1.0 * numTimedIterations);
@@ -542,6 +1065,7 @@ void ExecuteTransfers(EnvVars const& ev,
       {
         printf(" Executor: %3s %02d | %7.3f GB/s | %8.3f ms | %12lu bytes\n",
                ExeTypeName[exeType], exeIndex, exeBandwidthGbs, exeDurationMsec, exeInfo.totalBytes);
+        if (ev.showPercentiles) PrintLatencyStats(exeInfo.latencyHistogram, isMergedHistogram ? "Aggregate" : "Percentiles");
       }
 
       int totalCUs = 0;
@@ -563,6 +1087,11 @@ void ExecuteTransfers(EnvVars const& ev,
                  ExeTypeName[transfer->exeType], transfer->exeIndex,
                  transfer->numSubExecs,
                  transfer->DstToStr().c_str());
+          if (transfer->isLooping)
+            printf("      Looping     | %lu passes counted over %lu timed iterations\n", transfer->numLoopPasses, numTimedIterations);
+          if (ev.showPercentiles) PrintLatencyStats(transfer->latencyHistogram);
+          if (!transfer->gpuCounters.empty()) PrintGpuCounters(transfer->gpuCounters);
+          if (!transfer->numChunksPerSubExec.empty()) PrintChunkStats(transfer->numChunksPerSubExec, numTimedIterations);
 
           if (ev.showIterations)
           {
@@ -608,7 +1137,7 @@ void ExecuteTransfers(EnvVars const& ev,
         }
         else
         {
-          printf("%d,%d,%lu,%s,%c%02d,%s,%d,%.3f,%.3f,%s,%s\n",
+          printf("%d,%d,%lu,%s,%c%02d,%s,%d,%.3f,%.3f,%s,%s%s\n",
                  testNum, transfer->transferIndex, transfer->numBytesActual,
                  transfer->SrcToStr().c_str(),
                  MemTypeStr[transfer->exeType], transfer->exeIndex,
@@ -616,16 +1145,18 @@ void ExecuteTransfers(EnvVars const& ev,
                  transfer->numSubExecs,
                  transferBandwidthGbs, transferDurationMsec,
                  PtrVectorToStr(transfer->srcMem, initOffset).c_str(),
-                 PtrVectorToStr(transfer->dstMem, initOffset).c_str());
+                 PtrVectorToStr(transfer->dstMem, initOffset).c_str(),
+                 LatencyStatsCsv(ev, &transfer->latencyHistogram).c_str());
         }
       }
 
       if (verbose && ev.outputToCsv)
       {
-        printf("%d,ALL,%lu,ALL,%c%02d,ALL,%d,%.3f,%.3f,ALL,ALL\n",
+        printf("%d,ALL,%lu,ALL,%c%02d,ALL,%d,%.3f,%.3f,ALL,ALL%s\n",
                testNum, totalBytesTransferred,
                MemTypeStr[exeType], exeIndex, totalCUs,
-               exeBandwidthGbs, exeDurationMsec);
+               exeBandwidthGbs, exeDurationMsec,
+               LatencyStatsCsv(ev, isMergedHistogram ? NULL : &exeInfo.latencyHistogram).c_str());
       }
     }
   }
@@ -648,6 +1179,11 @@ void ExecuteTransfers(EnvVars const& ev,
                ExeTypeName[transfer->exeType], transfer->exeIndex,
                transfer->numSubExecs,
                transfer->DstToStr().c_str());
+        if (transfer->isLooping)
+          printf("      Looping     | %lu passes counted over %lu timed iterations\n", transfer->numLoopPasses, numTimedIterations);
+        if (ev.showPercentiles) PrintLatencyStats(transfer->latencyHistogram);
+        if (!transfer->gpuCounters.empty()) PrintGpuCounters(transfer->gpuCounters);
+        if (!transfer->numChunksPerSubExec.empty()) PrintChunkStats(transfer->numChunksPerSubExec, numTimedIterations);
 
         if (ev.showIterations)
         {
@@ -692,7 +1228,7 @@ void ExecuteTransfers(EnvVars const& ev,
       }
       else
       {
-        printf("%d,%d,%lu,%s,%s%02d,%s,%d,%.3f,%.3f,%s,%s\n",
+        printf("%d,%d,%lu,%s,%s%02d,%s,%d,%.3f,%.3f,%s,%s%s\n",
                testNum, transfer->transferIndex, transfer->numBytesActual,
                transfer->SrcToStr().c_str(),
                ExeTypeName[transfer->exeType], transfer->exeIndex,
@@ -700,7 +1236,8 @@ void ExecuteTransfers(EnvVars const& ev,
                transfer->numSubExecs,
                transferBandwidthGbs, transferDurationMsec,
                PtrVectorToStr(transfer->srcMem, initOffset).c_str(),
-               PtrVectorToStr(transfer->dstMem, initOffset).c_str());
+               PtrVectorToStr(transfer->dstMem, initOffset).c_str(),
+               LatencyStatsCsv(ev, &transfer->latencyHistogram).c_str());
       }
     }
   }
@@ -712,14 +1249,49 @@ void ExecuteTransfers(EnvVars const& ev,
     {
       printf(" Aggregate (CPU)  | %7.3f GB/s | %8.3f ms | %12lu bytes | Overhead: %.3f ms\n",
              totalBandwidthGbs, totalCpuTime, totalBytesTransferred, totalCpuTime - maxGpuTime);
+      if (usesManagedMemory && coldCpuTime >= 0)
+        printf(" Cold (CPU)       | %7.3f GB/s | %8.3f ms | %12lu bytes | First iteration (%.2fx warm time)%s\n",
+               (totalBytesTransferred / 1.0E6) / coldCpuTime, coldCpuTime, totalBytesTransferred,
+               coldCpuTime / totalCpuTime, ev.numWarmups ? "" : ", also timed");
     }
     else
     {
-      printf("%d,ALL,%lu,ALL,ALL,ALL,ALL,%.3f,%.3f,ALL,ALL\n",
-             testNum, totalBytesTransferred, totalBandwidthGbs, totalCpuTime);
+      printf("%d,ALL,%lu,ALL,ALL,ALL,ALL,%.3f,%.3f,ALL,ALL%s\n",
+             testNum, totalBytesTransferred, totalBandwidthGbs, totalCpuTime,
+             LatencyStatsCsv(ev, NULL).c_str());
+      if (usesManagedMemory && coldCpuTime >= 0)
+        printf("%d,COLD,%lu,ALL,ALL,ALL,ALL,%.3f,%.3f,ALL,ALL%s\n",
+               testNum, totalBytesTransferred, (totalBytesTransferred / 1.0E6) / coldCpuTime, coldCpuTime,
+               LatencyStatsCsv(ev, NULL).c_str());
+    }
+  }
+
+  // Report background load throughput alongside the Transfers, relative to running alone
+  if (verbose)
+  {
+    char const* unit = (ev.bgLoad == 1 ? "TFLOP/s" : "GB/s");
+    for (auto const& bgPair : backgroundThroughput)
+    {
+      double const soloThroughput = GetSoloBackgroundThroughput(ev, RemappedIndex(bgPair.first, false));
+      double const retainedPct    = 100.0 * bgPair.second / soloThroughput;
+      if (!ev.outputToCsv)
+        printf(" Background       | %9.3f %-7s | GPU %02d | %9.3f %s alone | %5.1f%% retained\n",
+               bgPair.second, unit, bgPair.first, soloThroughput, unit, retainedPct);
+      else
+        printf("%d,BG,GPU%02d,%s,%.3f,%.3f,%.1f\n",
+               testNum, bgPair.first, unit, bgPair.second, soloThroughput, retainedPct);
     }
   }
 
+  // Stream structured results
+  if (rank == 0 && ResultsSink::Get().IsOpen())
+    ReportTestResults(ev, testNum, transfers, numTimedIterations, totalCpuTime, totalBandwidthGbs, coldCpuTime,
+                      backgroundThroughput);
+
+  // Compare against baseline results
+  if (rank == 0 && BaselineChecker::Get().IsLoaded())
+    rerunTest = CheckBaseline(ev, testNum, transfers, numTimedIterations);
+
   // Release GPU memory
 cleanup:
   for (auto exeInfoPair : transferMap)
@@ -733,36 +1305,71 @@ cleanup:
       for (int iSrc = 0; iSrc < transfer->numSrcs; ++iSrc)
       {
         MemType const& srcType = transfer->srcType[iSrc];
-        DeallocateMemory(srcType, transfer->srcMem[iSrc], transfer->numBytesActual + ev.byteOffset);
+        if (transfer->SrcRank(iSrc) != rank)
+          HIP_CALL(hipIpcCloseMemHandle(transfer->srcMem[iSrc]));
+        else
+          ReleaseMemory(ev, srcType, transfer->srcMem[iSrc], transfer->numBytesActual + ev.byteOffset);
       }
       for (int iDst = 0; iDst < transfer->numDsts; ++iDst)
       {
         MemType const& dstType = transfer->dstType[iDst];
-        DeallocateMemory(dstType, transfer->dstMem[iDst], transfer->numBytesActual + ev.byteOffset);
+        if (transfer->DstRank(iDst) != rank)
+          HIP_CALL(hipIpcCloseMemHandle(transfer->dstMem[iDst]));
+        else
+          ReleaseMemory(ev, dstType, transfer->dstMem[iDst], transfer->numBytesActual + ev.byteOffset);
       }
       transfer->subExecParam.clear();
     }
 
     if (IsGpuType(exeType))
     {
-      int const numStreams = (int)exeInfo.streams.size();
-      for (int i = 0; i < numStreams; ++i)
+      DestroyGraphs(exeInfo);
+      ReleaseStreams(ev, exeIndex, exeInfo);
+
+      if (exeType == EXE_GPU_DMA && ev.useHsaDma)
       {
-        HIP_CALL(hipEventDestroy(exeInfo.startEvents[i]));
-        HIP_CALL(hipEventDestroy(exeInfo.stopEvents[i]));
-        HIP_CALL(hipStreamDestroy(exeInfo.streams[i]));
+        for (Transfer* transfer : exeInfo.transfers)
+          ReleaseHsaDmaTransfer(*transfer);
       }
 
       if (exeType == EXE_GPU_GFX)
       {
+        size_t const numParamBytes = exeInfo.numSubExecSlots * sizeof(SubExecParam) * NumParamSlices(ev);
 #if !defined(__NVCC__)
-        DeallocateMemory(MEM_GPU, exeInfo.subExecParamGpu);
+        ReleaseMemory(ev, MEM_GPU, exeInfo.subExecParamGpu, numParamBytes);
 #else
-        DeallocateMemory(MEM_CPU, exeInfo.subExecParamGpu);
+        ReleaseMemory(ev, MEM_CPU, exeInfo.subExecParamGpu, numParamBytes);
 #endif
+
+        if (ev.gpuKernel == GPU_KERNEL_STEAL)
+        {
+          size_t const numCounterBytes = exeInfo.transfers.size() * 2 * sizeof(unsigned long long);
+#if !defined(__NVCC__)
+          ReleaseMemory(ev, MEM_GPU, exeInfo.chunkCountersGpu, numCounterBytes);
+#else
+          ReleaseMemory(ev, MEM_CPU, exeInfo.chunkCountersGpu, numCounterBytes);
+#endif
+        }
       }
     }
   }
+
+  // Memory shared with other ranks can only be released once they have unmapped it
+  if (numRanks > 1)
+  {
+    MpBarrier();
+    for (auto const& mem : exportedMem)
+      ReleaseMemory(ev, std::get<0>(mem), std::get<1>(mem), std::get<2>(mem));
+  }
+
+  // Re-run Test with more iterations to confirm a suspected regression
+  if (rerunTest)
+  {
+    EnvVars retryEv = ev;
+    retryEv.numIterations = ev.baselineRetryIterations;
+    return ExecuteTransfers(retryEv, testNum, N, transfers, verbose, totalBandwidthCpu);
+  }
+  return isValid;
 }
 
 void DisplayUsage(char const* cmdName)
@@ -792,6 +1399,20 @@ void DisplayUsage(char const* cmdName)
   printf("                             - 4rd optional arg: GPU index to use as executor\n");
   printf("              a2a          - GPU All-To-All benchmark\n");
   printf("                             - 3rd optional arg: # of SubExecs to use\n");
+  printf("              allreduce    - Ring all-reduce collective pattern (reduce-scatter + all-gather)\n");
+  printf("              reducescatter- Ring reduce-scatter collective pattern\n");
+  printf("              allgather    - Ring all-gather collective pattern\n");
+  printf("              broadcast    - Pipelined binary-tree broadcast collective pattern\n");
+  printf("                             - 3rd optional arg: # of SubExecs (channels) per Transfer\n");
+  printf("                             - N is the total collective size in bytes\n");
+  printf("              contention   - Interference matrix between pairs of concurrent GPU peer-to-peer copies\n");
+  printf("              healthcheck  - Fast check of host, XGMI, all-to-all and DMA links within HC_TIME_LIMIT seconds\n");
+  printf("                             - Exits with non-zero code if any link is more than HC_TOLERANCE %% below expected\n");
+  printf("              latency      - Pointer-chase load latency and fine-grained flag ping-pong round trips between devices\n");
+  printf("                             - N is the size of the pointer-chase buffer\n");
+  printf("              autotune     - Search for best GFX Transfer settings per link class, written to AUTOTUNE_FILE\n");
+  printf("                             - 3rd optional arg: Max # of SubExecs to try (defaults to # of CUs)\n");
+  printf("              pipeline     - Chunked Transfer forwarded through PIPELINE_PATH with overlapping hops\n");
   printf("              cmdline      - Read Transfers from command line arguments (after N)\n");
   printf("  N     : (Optional) Number of bytes to copy per Transfer.\n");
   printf("          If not specified, defaults to %lu bytes. Must be a multiple of 4 bytes\n",
@@ -803,33 +1424,50 @@ void DisplayUsage(char const* cmdName)
   EnvVars::DisplayUsage();
 }
 
-int RemappedIndex(int const origIdx, bool const isCpuType)
+int& SelectedGpuIndexing()
+{
+  static int usePcieIndexing = -1;
+  return usePcieIndexing;
+}
+
+bool SelectGpuIndexing(int const usePcieIndexing)
 {
-  static std::vector<int> remappingCpu;
-  static std::vector<int> remappingGpu;
+  static std::mutex selectMutex;
+  std::lock_guard<std::mutex> lock(selectMutex);
 
-  // Build CPU remapping on first use
+  int& selected = SelectedGpuIndexing();
+  if (selected == -1) selected = usePcieIndexing;
+  return selected == usePcieIndexing;
+}
+
+int RemappedIndex(int const origIdx, bool const isCpuType)
+{
+  // Remappings are built on first use (thread-safe), and are shared by the whole process
   // Skip numa nodes that are not configured
-  if (remappingCpu.empty())
+  static std::vector<int> const remappingCpu = []()
   {
+    std::vector<int> remapping;
     for (int node = 0; node <= numa_max_node(); node++)
       if (numa_bitmask_isbitset(numa_get_mems_allowed(), node))
-        remappingCpu.push_back(node);
-  }
+        remapping.push_back(node);
+    return remapping;
+  }();
 
-  // Build remappingGpu on first use
-  if (remappingGpu.empty())
+  static std::vector<int> const remappingGpu = []()
   {
     int numGpuDevices;
     HIP_CALL(hipGetDeviceCount(&numGpuDevices));
-    remappingGpu.resize(numGpuDevices);
+    std::vector<int> remapping(numGpuDevices);
 
-    int const usePcieIndexing = getenv("USE_PCIE_INDEX") ? atoi(getenv("USE_PCIE_INDEX")) : 0;
-    if (!usePcieIndexing)
+    // Without any EnvVars having selected the indexing (e.g. when only displaying the topology), the process
+    // environment decides
+    char const* usePcieIndexStr = getenv("USE_PCIE_INDEX");
+    SelectGpuIndexing(usePcieIndexStr ? atoi(usePcieIndexStr) : 0);
+    if (!SelectedGpuIndexing())
     {
-      // For HIP-based indexing no remappingGpu is necessary
+      // For HIP-based indexing no remapping is necessary
       for (int i = 0; i < numGpuDevices; ++i)
-        remappingGpu[i] = i;
+        remapping[i] = i;
     }
     else
     {
@@ -844,42 +1482,212 @@ int RemappedIndex(int const origIdx, bool const isCpuType)
       // Sort GPUs by PCIe address then use that as mapping
       std::sort(mapping.begin(), mapping.end());
       for (int i = 0; i < numGpuDevices; ++i)
-        remappingGpu[i] = mapping[i].second;
+        remapping[i] = mapping[i].second;
     }
-  }
+    return remapping;
+  }();
+
   return isCpuType ? remappingCpu[origIdx] : remappingGpu[origIdx];
 }
 
-void DisplayTopology(bool const outputToCsv)
+JsonObject GetTopologyJson(EnvVars const& ev)
 {
+  JsonObject topology;
+  topology.Add("numCpus", ev.numCpuDevices).Add("numGpus", ev.numGpuDevices);
 
-  int numCpuDevices = numa_num_configured_nodes();
-  int numGpuDevices;
-  HIP_CALL(hipGetDeviceCount(&numGpuDevices));
+  std::vector<JsonObject> cpus(ev.numCpuDevices);
+  for (int i = 0; i < ev.numCpuDevices; i++)
+    cpus[i].Add("index", i).Add("numaNode", RemappedIndex(i, true)).Add("numCores", ev.numCpusPerNuma[i]);
+  topology.Add("cpus", cpus);
 
-  if (outputToCsv)
+  std::vector<JsonObject> gpus(ev.numGpuDevices);
+  for (int i = 0; i < ev.numGpuDevices; i++)
   {
-    printf("NumCpus,%d\n", numCpuDevices);
-    printf("NumGpus,%d\n", numGpuDevices);
+    int const deviceIdx = RemappedIndex(i, false);
+    hipDeviceProp_t prop;
+    HIP_CALL(hipGetDeviceProperties(&prop, deviceIdx));
+    int numDeviceCUs = 0;
+    HIP_CALL(hipDeviceGetAttribute(&numDeviceCUs, hipDeviceAttributeMultiprocessorCount, deviceIdx));
+    char pciBusId[20];
+    HIP_CALL(hipDeviceGetPCIBusId(pciBusId, 20, deviceIdx));
+
+    gpus[i].Add("index", i).Add("device", deviceIdx).Add("name", prop.name).Add("pciBusId", pciBusId).Add("numCUs", numDeviceCUs);
+#if !defined(__NVCC__)
+    std::string const fullName = prop.gcnArchName;
+    gpus[i].Add("arch", fullName.substr(0, fullName.find(':'))).Add("closestNuma", GetClosestNumaNode(deviceIdx));
+
+    // Link type / hop count to every other GPU
+    std::vector<std::string> links(ev.numGpuDevices, "-");
+    for (int j = 0; j < ev.numGpuDevices; j++)
+    {
+      if (i == j) continue;
+      uint32_t linkType, hopCount;
+      HIP_CALL(hipExtGetLinkTypeAndHopCount(deviceIdx, RemappedIndex(j, false), &linkType, &hopCount));
+      links[j] = GetLinkTypeDesc(linkType, hopCount);
+    }
+    gpus[i].Add("links", links);
+#endif
   }
-  else
+  topology.Add("gpus", gpus);
+  return topology;
+}
+
+void ReportTestResults(EnvVars const& ev, int const testNum, std::vector<Transfer> const& transfers,
+                       size_t const numTimedIterations, double const cpuTimeMsec, double const cpuBandwidthGbs,
+                       double const coldCpuTimeMsec, std::map<int, double> const& backgroundThroughput)
+{
+  std::vector<JsonObject> transferResults;
+  for (Transfer const& transfer : transfers)
   {
-    printf("\nDetected topology: %d configured CPU NUMA node(s) [%d total]   %d GPU device(s)\n",
-           numa_num_configured_nodes(), numa_max_node() + 1, numGpuDevices);
+    double const timeMsec      = transfer.transferTime / numTimedIterations;
+    double const bandwidthGbs  = (transfer.numBytesActual / 1.0E9) / timeMsec * 1000.0;
+    std::string const exeStr   = std::string(1, ExeTypeStr[transfer.exeType]) + std::to_string(transfer.exeIndex);
+
+    JsonObject result;
+    result.Add("index", transfer.transferIndex)
+      .Add("src", transfer.SrcToStr()).Add("exe", exeStr).Add("dst", transfer.DstToStr())
+      .Add("exeRank", transfer.exeRank).Add("numSubExecs", transfer.numSubExecs)
+      .Add("numBytes", transfer.numBytesActual).Add("timeMs", timeMsec).Add("bandwidthGbs", bandwidthGbs);
+    if (transfer.exeSubIndex != -1) result.Add("exeSubIndex", transfer.exeSubIndex);
+    if (transfer.isLooping)         result.Add("numLoopPasses", transfer.numLoopPasses);
+
+    // Per-iteration statistics are only available for Transfers executed by this rank
+    LatencyHistogram const& histogram = transfer.latencyHistogram;
+    if (histogram.Count())
+    {
+      JsonObject stats;
+      stats.Add("count", histogram.Count()).Add("minMs", histogram.Min()).Add("meanMs", histogram.Mean())
+        .Add("p50Ms", histogram.Percentile(50.0)).Add("p90Ms", histogram.Percentile(90.0))
+        .Add("p99Ms", histogram.Percentile(99.0)).Add("maxMs", histogram.Max()).Add("stdDevMs", histogram.StdDev());
+      result.Add("iterationStats", stats);
+    }
+    if (!transfer.perIterationTime.empty()) result.Add("iterationTimesMs", transfer.perIterationTime);
+    if (!transfer.numChunksPerSubExec.empty())
+    {
+      std::vector<double> chunksPerIteration;
+      for (size_t numChunks : transfer.numChunksPerSubExec)
+        chunksPerIteration.push_back(numChunks / (double)numTimedIterations);
+      result.Add("chunksPerSubExec", chunksPerIteration);
+    }
+    if (!transfer.gpuCounters.empty())
+    {
+      JsonObject counters;
+      for (auto const& counter : transfer.gpuCounters)
+        counters.Add(counter.first, counter.second);
+      result.Add("gpuCounters", counters);
+    }
+    transferResults.push_back(result);
   }
 
-  // Print out detected CPU topology
-  if (outputToCsv)
+  JsonObject record;
+  record.Add("preset", ConfigModeName[ev.configMode]).Add("testNum", testNum)
+    .Add("numIterations", numTimedIterations).Add("cpuTimeMs", cpuTimeMsec).Add("cpuBandwidthGbs", cpuBandwidthGbs);
+  if (coldCpuTimeMsec >= 0) record.Add("coldCpuTimeMs", coldCpuTimeMsec);
+  if (BaselineChecker::Get().isRetrying) record.Add("retry", true);
+  record.Add("transfers", transferResults);
+  if (!backgroundThroughput.empty())
   {
-    printf("NUMA");
-    for (int j = 0; j < numCpuDevices; j++)
-      printf(",NUMA%02d", j);
-    printf(",# CPUs,ClosestGPUs,ActualNode\n");
+    std::vector<JsonObject> backgroundResults;
+    for (auto const& bgPair : backgroundThroughput)
+    {
+      JsonObject result;
+      result.Add("gpu", bgPair.first).Add("load", ev.bgLoad == 1 ? "compute" : "memory")
+        .Add("unit", ev.bgLoad == 1 ? "TFLOP/s" : "GB/s").Add("duringTest", bgPair.second)
+        .Add("alone", GetSoloBackgroundThroughput(ev, RemappedIndex(bgPair.first, false)));
+      backgroundResults.push_back(result);
+    }
+    record.Add("background", backgroundResults);
   }
-  else
-  {
-    printf("            |");
-    for (int j = 0; j < numCpuDevices; j++)
+  ResultsSink::Get().Write("test", record);
+}
+
+bool CheckBaseline(EnvVars const& ev, int const testNum, std::vector<Transfer> const& transfers,
+                   size_t const numTimedIterations)
+{
+  BaselineChecker& baseline = BaselineChecker::Get();
+
+  // Keys are only generated for the first run of a Test, so that re-runs compare against the same entries
+  if (!baseline.isRetrying)
+  {
+    baseline.testKeys.clear();
+    for (Transfer const& transfer : transfers)
+    {
+      std::string const exeStr = std::string(1, ExeTypeStr[transfer.exeType]) + std::to_string(transfer.exeIndex);
+      baseline.testKeys.push_back(baseline.NextKey(
+          BaselineChecker::MakeKey(ConfigModeName[ev.configMode], transfers.size(), transfer.transferIndex,
+                                   transfer.SrcToStr(), exeStr, transfer.exeRank, transfer.DstToStr(),
+                                   transfer.numBytesActual, transfer.numSubExecs)));
+    }
+  }
+
+  // Determine which Transfers fall short of their baseline by more than the tolerance
+  std::vector<double> baselineGbs(transfers.size(), -1.0);
+  std::vector<double> measuredGbs(transfers.size());
+  bool hasRegression = false;
+  for (int i = 0; i < transfers.size(); i++)
+  {
+    double const timeMsec = transfers[i].transferTime / numTimedIterations;
+    measuredGbs[i] = (transfers[i].numBytesActual / 1.0E9) / timeMsec * 1000.0;
+    if (baseline.GetBaseline(baseline.testKeys[i], baselineGbs[i]) &&
+        measuredGbs[i] < baselineGbs[i] * (1.0 - ev.baselineTolerance / 100.0))
+      hasRegression = true;
+  }
+
+  if (hasRegression && !baseline.isRetrying && ev.baselineRetryIterations > 0)
+  {
+    printf("Test %d: Possible regression detected - re-running with %d iterations\n",
+           testNum, ev.baselineRetryIterations);
+    baseline.isRetrying = true;
+    return true;
+  }
+  baseline.isRetrying = false;
+
+  for (int i = 0; i < transfers.size(); i++)
+  {
+    bool const isMissing    = (baselineGbs[i] < 0);
+    bool const isRegression = !isMissing && measuredGbs[i] < baselineGbs[i] * (1.0 - ev.baselineTolerance / 100.0);
+    if (isRegression)
+    {
+      printf("[REGRESSION] Test %d Transfer %d (%s -> %c%d -> %s): %.3f GB/s vs baseline %.3f GB/s (%+.1f%%)\n",
+             testNum, i, transfers[i].SrcToStr().c_str(),
+             ExeTypeStr[transfers[i].exeType], transfers[i].exeIndex, transfers[i].DstToStr().c_str(),
+             measuredGbs[i], baselineGbs[i], (measuredGbs[i] / baselineGbs[i] - 1.0) * 100.0);
+    }
+    baseline.AddResult(isMissing, isRegression);
+  }
+  return false;
+}
+
+void DisplayTopology(bool const outputToCsv)
+{
+
+  int numCpuDevices = numa_num_configured_nodes();
+  int numGpuDevices;
+  HIP_CALL(hipGetDeviceCount(&numGpuDevices));
+
+  if (outputToCsv)
+  {
+    printf("NumCpus,%d\n", numCpuDevices);
+    printf("NumGpus,%d\n", numGpuDevices);
+  }
+  else
+  {
+    printf("\nDetected topology: %d configured CPU NUMA node(s) [%d total]   %d GPU device(s)\n",
+           numa_num_configured_nodes(), numa_max_node() + 1, numGpuDevices);
+  }
+
+  // Print out detected CPU topology
+  if (outputToCsv)
+  {
+    printf("NUMA");
+    for (int j = 0; j < numCpuDevices; j++)
+      printf(",NUMA%02d", j);
+    printf(",# CPUs,ClosestGPUs,ActualNode\n");
+  }
+  else
+  {
+    printf("            |");
+    for (int j = 0; j < numCpuDevices; j++)
       printf("NUMA %02d|", j);
     printf(" #Cpus | Closest GPU(s)\n");
 
@@ -1005,8 +1813,54 @@ void DisplayTopology(bool const outputToCsv)
 #endif
 }
 
+std::string GetLinkTypeDesc(uint32_t linkType, uint32_t hopCount)
+{
+#if defined(__NVCC__)
+  return "PEER";
+#else
+  char result[16];
+  sprintf(result, "%s-%d",
+          linkType == HSA_AMD_LINK_INFO_TYPE_HYPERTRANSPORT ? "HT"   :
+          linkType == HSA_AMD_LINK_INFO_TYPE_QPI            ? "QPI"  :
+          linkType == HSA_AMD_LINK_INFO_TYPE_PCIE           ? "PCIE" :
+          linkType == HSA_AMD_LINK_INFO_TYPE_INFINBAND      ? "INFB" :
+          linkType == HSA_AMD_LINK_INFO_TYPE_XGMI           ? "XGMI" : "????",
+          hopCount);
+  return result;
+#endif
+}
+
+thread_local bool throwInputErrors = false;
+thread_local bool throwRunErrors   = false;
+
+void InputError(char const* format, ...)
+{
+  char message[MAX_LINE_LEN];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(message, sizeof(message), format, args);
+  va_end(args);
+
+  if (throwInputErrors) throw std::invalid_argument(message);
+  printf("[ERROR] %s\n", message);
+  exit(1);
+}
+
+void RunError(char const* format, ...)
+{
+  char message[MAX_LINE_LEN];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(message, sizeof(message), format, args);
+  va_end(args);
+
+  if (throwRunErrors) throw std::runtime_error(message);
+  printf("[ERROR] %s\n", message);
+  exit(1);
+}
+
 void ParseMemType(std::string const& token, int const numCpus, int const numGpus,
-                  std::vector<MemType>& memTypes, std::vector<int>& memIndices)
+                  std::vector<MemType>& memTypes, std::vector<int>& memIndices, std::vector<int>& memRanks)
 {
   char typeChar;
   int offset = 0, devIndex, inc;
@@ -1014,20 +1868,30 @@ void ParseMemType(std::string const& token, int const numCpus, int const numGpus
 
   memTypes.clear();
   memIndices.clear();
+  memRanks.clear();
   while (sscanf(token.c_str() + offset, " %c %d%n", &typeChar, &devIndex, &inc) == 2)
   {
     offset += inc;
     MemType memType = CharToMemType(typeChar);
 
+    // Device index may optionally be followed by @<rank> to refer to memory owned by another process
+    int memRank = 0;
+    if (token[offset] == '@')
+    {
+      if (sscanf(token.c_str() + offset, "@%d%n", &memRank, &inc) != 1)
+      {
+        InputError("Unable to parse rank in memory type token %s", token.c_str());
+      }
+      offset += inc;
+    }
+
     if (IsCpuType(memType) && (devIndex < 0 || devIndex >= numCpus))
     {
-      printf("[ERROR] CPU index must be between 0 and %d (instead of %d)\n", numCpus-1, devIndex);
-      exit(1);
+      InputError("CPU index must be between 0 and %d (instead of %d)", numCpus-1, devIndex);
     }
     if (IsGpuType(memType) && (devIndex < 0 || devIndex >= numGpus))
     {
-      printf("[ERROR] GPU index must be between 0 and %d (instead of %d)\n", numGpus-1, devIndex);
-      exit(1);
+      InputError("GPU index must be between 0 and %d (instead of %d)", numGpus-1, devIndex);
     }
 
     found = true;
@@ -1035,37 +1899,91 @@ void ParseMemType(std::string const& token, int const numCpus, int const numGpus
     {
       memTypes.push_back(memType);
       memIndices.push_back(devIndex);
+      memRanks.push_back(memRank);
     }
   }
   if (!found)
   {
-    printf("[ERROR] Unable to parse memory type token %s.  Expected one of %s followed by an index\n",
-           token.c_str(), MemTypeStr);
-    exit(1);
+    InputError("Unable to parse memory type token %s.  Expected one of %s followed by an index",
+               token.c_str(), MemTypeStr);
   }
 }
 
 void ParseExeType(std::string const& token, int const numCpus, int const numGpus,
-                  ExeType &exeType, int& exeIndex)
+                  ExeType &exeType, int& exeIndex, int& exeRank, int& exeSubIndex)
 {
   char typeChar;
-  if (sscanf(token.c_str(), " %c%d", &typeChar, &exeIndex) != 2)
+  int offset;
+  if (sscanf(token.c_str(), " %c%d%n", &typeChar, &exeIndex, &offset) != 2)
   {
-    printf("[ERROR] Unable to parse valid executor token (%s).  Exepected one of %s followed by an index\n",
-           token.c_str(), ExeTypeStr);
-    exit(1);
+    InputError("Unable to parse valid executor token (%s).  Exepected one of %s followed by an index",
+               token.c_str(), ExeTypeStr);
+  }
+
+  // Executor index may optionally be followed by .<engine> to select an SDMA engine for DMA executors
+  exeSubIndex = -1;
+  if (token[offset] == '.' && sscanf(token.c_str() + offset, ".%d", &exeSubIndex) != 1)
+  {
+    InputError("Unable to parse SDMA engine in executor token %s", token.c_str());
+  }
+
+  // Executor index may optionally be followed by @<rank> to run on another process
+  exeRank = 0;
+  char const* rankStr = strchr(token.c_str(), '@');
+  if (rankStr && sscanf(rankStr, "@%d", &exeRank) != 1)
+  {
+    InputError("Unable to parse rank in executor token %s", token.c_str());
   }
   exeType = CharToExeType(typeChar);
+  if (exeSubIndex != -1 && (exeType != EXE_GPU_DMA || exeSubIndex < 0))
+  {
+    InputError("SDMA engine may only be specified (as non-negative index) for DMA executors (instead of %s)",
+               token.c_str());
+  }
 
   if (IsCpuType(exeType) && (exeIndex < 0 || exeIndex >= numCpus))
   {
-    printf("[ERROR] CPU index must be between 0 and %d (instead of %d)\n", numCpus-1, exeIndex);
-    exit(1);
+    InputError("CPU index must be between 0 and %d (instead of %d)", numCpus-1, exeIndex);
   }
   if (IsGpuType(exeType) && (exeIndex < 0 || exeIndex >= numGpus))
   {
-    printf("[ERROR] GPU index must be between 0 and %d (instead of %d)\n", numGpus-1, exeIndex);
-    exit(1);
+    InputError("GPU index must be between 0 and %d (instead of %d)", numGpus-1, exeIndex);
+  }
+}
+
+// Checks that a parsed Transfer (numbered from 1) can be executed
+void CheckTransfer(Transfer const& transfer, int const transferNum)
+{
+  if (transfer.numSrcs == 0 && transfer.numDsts == 0)
+  {
+    InputError("Transfer must have at least one src or dst");
+  }
+
+  // Memory owned by another rank is shared via IPC handles, so must be GPU memory accessed by a GPU executor
+  std::vector<int> ranks(transfer.srcRank);
+  ranks.insert(ranks.end(), transfer.dstRank.begin(), transfer.dstRank.end());
+  ranks.push_back(transfer.exeRank);
+  for (int rank : ranks)
+  {
+    if (rank < 0 || rank >= MpNumRanks())
+    {
+      InputError("Transfer %d refers to rank %d, however only %d rank(s) are running", transferNum, rank, MpNumRanks());
+    }
+  }
+  for (int j = 0; j < transfer.numSrcs + transfer.numDsts; j++)
+  {
+    bool    const isSrc   = (j < transfer.numSrcs);
+    MemType const memType = isSrc ? transfer.srcType[j] : transfer.dstType[j - transfer.numSrcs];
+    int     const memRank = isSrc ? transfer.srcRank[j] : transfer.dstRank[j - transfer.numSrcs];
+    if (memRank != transfer.exeRank && (!IsGpuType(memType) || memType == MEM_MANAGED || !IsGpuType(transfer.exeType)))
+    {
+      InputError("Transfer %d: Memory owned by another rank must be GPU memory used by a GPU executor", transferNum);
+    }
+  }
+
+  if (transfer.exeType == EXE_GPU_DMA && (transfer.numSrcs > 1 || transfer.numDsts > 1))
+  {
+    InputError("GPU DMA executor can only be used for single source / single dst Transfers");
   }
 }
 
@@ -1092,15 +2010,28 @@ void ParseTransfers(char* line, int numCpus, int numGpus, std::vector<Transfer>&
   bool const advancedMode = (numTransfers < 0);
   numTransfers = abs(numTransfers);
 
+  // Number of subExecutors may be "auto" to use the value from the autotune table
+  auto parseNumSubExecs = [](std::string const& token)
+  {
+    if (token == "auto") return AUTO_SUBEXECS;
+    int numSubExecs = 0;
+    if (sscanf(token.c_str(), "%d", &numSubExecs) != 1 || numSubExecs <= 0)
+    {
+      InputError("Number of blocks to use (%s) must be greater than 0 or \"auto\"", token.c_str());
+    }
+    return numSubExecs;
+  };
+
   int numSubExecs;
+  std::string numSubExecsToken;
   if (!advancedMode)
   {
-    iss >> numSubExecs;
-    if (numSubExecs <= 0 || iss.fail())
+    iss >> numSubExecsToken;
+    if (iss.fail())
     {
-      printf("Parsing error: Number of blocks to use (%d) must be greater than 0\n", numSubExecs);
-      exit(1);
+      InputError("Unable to read number of blocks to use");
     }
+    numSubExecs = parseNumSubExecs(numSubExecsToken);
   }
 
   size_t numBytes = 0;
@@ -1114,23 +2045,21 @@ void ParseTransfers(char* line, int numCpus, int numGpus, std::vector<Transfer>&
       iss >> srcMem >> exeMem >> dstMem;
       if (iss.fail())
       {
-        printf("Parsing error: Unable to read valid Transfer %d (SRC EXE DST) triplet\n", i+1);
-        exit(1);
+        InputError("Unable to read valid Transfer %d (SRC EXE DST) triplet", i+1);
       }
     }
     else
     {
       std::string numBytesToken;
-      iss >> srcMem >> exeMem >> dstMem >> numSubExecs >> numBytesToken;
+      iss >> srcMem >> exeMem >> dstMem >> numSubExecsToken >> numBytesToken;
       if (iss.fail())
       {
-        printf("Parsing error: Unable to read valid Transfer %d (SRC EXE DST #CU #Bytes) tuple\n", i+1);
-        exit(1);
+        InputError("Unable to read valid Transfer %d (SRC EXE DST #CU #Bytes) tuple", i+1);
       }
+      numSubExecs = parseNumSubExecs(numSubExecsToken);
       if (sscanf(numBytesToken.c_str(), "%lu", &numBytes) != 1)
       {
-        printf("Parsing error: '%s' is not a valid expression of numBytes for Transfer %d\n", numBytesToken.c_str(), i+1);
-        exit(1);
+        InputError("'%s' is not a valid expression of numBytes for Transfer %d", numBytesToken.c_str(), i+1);
       }
       char units = numBytesToken.back();
       switch (toupper(units))
@@ -1141,23 +2070,20 @@ void ParseTransfers(char* line, int numCpus, int numGpus, std::vector<Transfer>&
       }
     }
 
-    ParseMemType(srcMem, numCpus, numGpus, transfer.srcType, transfer.srcIndex);
-    ParseMemType(dstMem, numCpus, numGpus, transfer.dstType, transfer.dstIndex);
-    ParseExeType(exeMem, numCpus, numGpus, transfer.exeType, transfer.exeIndex);
-
-    transfer.numSrcs = (int)transfer.srcType.size();
-    transfer.numDsts = (int)transfer.dstType.size();
-    if (transfer.numSrcs == 0 && transfer.numDsts == 0)
+    // Executor may be suffixed with '*' to loop the Transfer until all other Transfers in the Test are done
+    if (!exeMem.empty() && exeMem.back() == '*')
     {
-      printf("[ERROR] Transfer must have at least one src or dst\n");
-      exit(1);
+      transfer.isLooping = true;
+      exeMem.pop_back();
     }
 
-    if (transfer.exeType == EXE_GPU_DMA && (transfer.numSrcs > 1 || transfer.numDsts > 1))
-    {
-      printf("[ERROR] GPU DMA executor can only be used for single source / single dst Transfers\n");
-      exit(1);
-    }
+    ParseMemType(srcMem, numCpus, numGpus, transfer.srcType, transfer.srcIndex, transfer.srcRank);
+    ParseMemType(dstMem, numCpus, numGpus, transfer.dstType, transfer.dstIndex, transfer.dstRank);
+    ParseExeType(exeMem, numCpus, numGpus, transfer.exeType, transfer.exeIndex, transfer.exeRank, transfer.exeSubIndex);
+
+    transfer.numSrcs = (int)transfer.srcType.size();
+    transfer.numDsts = (int)transfer.dstType.size();
+    CheckTransfer(transfer, i+1);
 
     transfer.numSubExecs = numSubExecs;
     transfer.numBytes = numBytes;
@@ -1171,25 +2097,62 @@ void EnablePeerAccess(int const deviceId, int const peerDeviceId)
   HIP_CALL(hipDeviceCanAccessPeer(&canAccess, deviceId, peerDeviceId));
   if (!canAccess)
   {
-    printf("[ERROR] Unable to enable peer access from GPU devices %d to %d\n", peerDeviceId, deviceId);
-    exit(1);
+    RunError("Unable to enable peer access from GPU devices %d to %d", peerDeviceId, deviceId);
   }
   HIP_CALL(hipSetDevice(deviceId));
   hipError_t error = hipDeviceEnablePeerAccess(peerDeviceId, 0);
   if (error != hipSuccess && error != hipErrorPeerAccessAlreadyEnabled)
   {
-    printf("[ERROR] Unable to enable peer to peer access from %d to %d (%s)\n",
-           deviceId, peerDeviceId, hipGetErrorString(error));
-    exit(1);
+    RunError("Unable to enable peer to peer access from %d to %d (%s)",
+             deviceId, peerDeviceId, hipGetErrorString(error));
+  }
+}
+
+void ExchangeRemoteMemory(EnvVars const& ev, size_t const N, std::vector<Transfer>& transfers,
+                          std::vector<std::tuple<MemType, float*, size_t>>& exportedMem)
+{
+  int const rank = MpRank();
+
+  // All ranks walk through the same list of Transfers, so that every broadcast is matched
+  for (Transfer& transfer : transfers)
+  {
+    size_t const numBytes = (transfer.numBytes ? transfer.numBytes : N * sizeof(float)) + ev.byteOffset;
+    for (int j = 0; j < transfer.numSrcs + transfer.numDsts; j++)
+    {
+      bool    const isSrc    = (j < transfer.numSrcs);
+      int     const memIdx   = isSrc ? j : j - transfer.numSrcs;
+      int     const memRank  = isSrc ? transfer.SrcRank(memIdx)  : transfer.DstRank(memIdx);
+      MemType const memType  = isSrc ? transfer.srcType[memIdx]  : transfer.dstType[memIdx];
+      int     const memIndex = isSrc ? transfer.srcIndex[memIdx] : transfer.dstIndex[memIdx];
+      if (memRank == transfer.exeRank) continue;
+
+      // Owning rank allocates the memory and exports an IPC handle for it
+      hipIpcMemHandle_t handle;
+      if (rank == memRank)
+      {
+        float* memPtr;
+        AcquireMemory(ev, memType, RemappedIndex(memIndex, false), numBytes, (void**)&memPtr);
+        HIP_CALL(hipIpcGetMemHandle(&handle, memPtr));
+        exportedMem.push_back(std::make_tuple(memType, memPtr, numBytes));
+      }
+      MpBroadcast(&handle, sizeof(handle), memRank);
+
+      // Executing rank maps the memory onto the executing GPU
+      if (rank == transfer.exeRank)
+      {
+        float*& memPtr = isSrc ? transfer.srcMem[memIdx] : transfer.dstMem[memIdx];
+        HIP_CALL(hipSetDevice(RemappedIndex(transfer.exeIndex, false)));
+        HIP_CALL(hipIpcOpenMemHandle((void**)&memPtr, handle, hipIpcMemLazyEnablePeerAccess));
+      }
+    }
   }
 }
 
-void AllocateMemory(MemType memType, int devIndex, size_t numBytes, void** memPtr)
+void AllocateMemory(EnvVars const& ev, MemType memType, int devIndex, size_t numBytes, void** memPtr)
 {
   if (numBytes == 0)
   {
-    printf("[ERROR] Unable to allocate 0 bytes\n");
-    exit(1);
+    RunError("Unable to allocate 0 bytes");
   }
   *memPtr = nullptr;
   if (IsCpuType(memType))
@@ -1201,8 +2164,7 @@ void AllocateMemory(MemType memType, int devIndex, size_t numBytes, void** memPt
     if (memType == MEM_CPU_FINE)
     {
 #if defined (__NVCC__)
-      printf("[ERROR] Fine-grained CPU memory not supported on NVIDIA platform\n");
-      exit(1);
+      RunError("Fine-grained CPU memory not supported on NVIDIA platform");
 #else
       HIP_CALL(hipHostMalloc((void **)memPtr, numBytes, hipHostMallocNumaUser));
 #endif
@@ -1215,24 +2177,81 @@ void AllocateMemory(MemType memType, int devIndex, size_t numBytes, void** memPt
       if (hipHostMalloc((void **)memPtr, numBytes, hipHostMallocNumaUser | hipHostMallocNonCoherent) != hipSuccess)
 #endif
       {
-        printf("[ERROR] Unable to allocate non-coherent host memory on NUMA node %d\n", devIndex);
-        exit(1);
+        RunError("Unable to allocate non-coherent host memory on NUMA node %d", devIndex);
       }
     }
     else if (memType == MEM_CPU_UNPINNED)
     {
       *memPtr = numa_alloc_onnode(numBytes, devIndex);
     }
+    else if (memType == MEM_CPU_INTERLV)
+    {
+      // Interleave policy replaces the preferred node policy for the duration of the allocation
+      numa_set_interleave_mask(numa_all_nodes_ptr);
+#if defined (__NVCC__)
+      if (hipHostMalloc((void **)memPtr, numBytes, 0) != hipSuccess)
+#else
+      if (hipHostMalloc((void **)memPtr, numBytes, hipHostMallocNumaUser | hipHostMallocNonCoherent) != hipSuccess)
+#endif
+      {
+        RunError("Unable to allocate interleaved host memory");
+      }
+      numa_set_interleave_mask(numa_no_nodes_ptr);
+    }
+    else if (memType == MEM_CPU_HUGE)
+    {
+      // Map explicitly sized huge pages, which must have been reserved beforehand
+      size_t const hugePageBytes = (size_t)ev.hugePageSizeMb << 20;
+      size_t const mappedBytes   = (numBytes + hugePageBytes - 1) / hugePageBytes * hugePageBytes;
+      int    const hugePageFlag  = __builtin_ctzll(hugePageBytes) << MAP_HUGE_SHIFT;
+      *memPtr = mmap(NULL, mappedBytes, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | hugePageFlag, -1, 0);
+      if (*memPtr == MAP_FAILED)
+      {
+        RunError("Unable to map %lu bytes of %dMB huge pages on NUMA node %d.  Check that enough are reserved in\n"
+                 "        /sys/devices/system/node/node%d/hugepages/hugepages-%lukB/nr_hugepages",
+                 mappedBytes, ev.hugePageSizeMb, devIndex, devIndex, hugePageBytes >> 10);
+      }
+      numa_tonode_memory(*memPtr, mappedBytes, devIndex);
+      AddHugePageMapping(*memPtr, mappedBytes);
+    }
+    else if (memType == MEM_CPU_USER)
+    {
+      // Plain user allocation that is placed by first touch (below) instead of by NUMA memory policy
+      numa_set_preferred(-1);
+      if (posix_memalign(memPtr, getpagesize(), numBytes))
+      {
+        RunError("Unable to allocate %lu bytes of user host memory", numBytes);
+      }
+    }
 
-    // Check that the allocated pages are actually on the correct NUMA node
+    // First-touch user memory from a core of the target NUMA node, then restore the original affinity
+    cpu_set_t cpuSet;
+    if (memType == MEM_CPU_USER)
+    {
+      sched_getaffinity(0, sizeof(cpuSet), &cpuSet);
+      numa_run_on_node(devIndex);
+    }
     memset(*memPtr, 0, numBytes);
-    CheckPages((char*)*memPtr, numBytes, devIndex);
+    if (memType == MEM_CPU_USER)
+      sched_setaffinity(0, sizeof(cpuSet), &cpuSet);
+
+    // Check that the allocated pages are actually on the correct NUMA node(s)
+    CheckPages((char*)*memPtr, numBytes, memType == MEM_CPU_INTERLV ? -1 : devIndex);
+
+    // Register (and pin) memory that was not allocated through HIP
+    if (memType == MEM_CPU_HUGE || memType == MEM_CPU_USER)
+      HIP_CALL(hipHostRegister(*memPtr, numBytes, hipHostRegisterDefault));
 
     // Reset to default numa mem policy
     numa_set_preferred(-1);
   }
   else if (IsGpuType(memType))
   {
+    // GPU allocations are cleared / synchronized on the null stream, which waits on a background load using BG_CU_MASK
+    if (ev.bgCuMask.size() && GetBackgroundLoadDevices().count(devIndex))
+      InputError("Unable to allocate GPU memory on device %d while a BG_CU_MASK background load is running on it", devIndex);
+
     if (memType == MEM_GPU)
     {
       // Allocate GPU memory on appropriate device
@@ -1242,8 +2261,7 @@ void AllocateMemory(MemType memType, int devIndex, size_t numBytes, void** memPt
     else if (memType == MEM_GPU_FINE)
     {
 #if defined (__NVCC__)
-      printf("[ERROR] Fine-grained GPU memory not supported on NVIDIA platform\n");
-      exit(1);
+      RunError("Fine-grained GPU memory not supported on NVIDIA platform");
 #else
       HIP_CALL(hipSetDevice(devIndex));
 
@@ -1255,19 +2273,40 @@ void AllocateMemory(MemType memType, int devIndex, size_t numBytes, void** memPt
       HIP_CALL(hipExtMallocWithFlags((void**)memPtr, numBytes, flag));
 #endif
     }
-    HIP_CALL(hipMemset(*memPtr, 0, numBytes));
-    HIP_CALL(hipDeviceSynchronize());
+    else if (memType == MEM_MANAGED)
+    {
+      HIP_CALL(hipSetDevice(devIndex));
+      HIP_CALL(hipMallocManaged(memPtr, numBytes));
+      if (ev.managedAdvice == 1)
+        HIP_CALL(hipMemAdvise(*memPtr, numBytes, hipMemAdviseSetPreferredLocation, devIndex));
+      else if (ev.managedAdvice == 2)
+        HIP_CALL(hipMemAdvise(*memPtr, numBytes, hipMemAdviseSetReadMostly, devIndex));
+#if !defined (__NVCC__)
+      else if (ev.managedAdvice == 3)
+        HIP_CALL(hipMemAdvise(*memPtr, numBytes, hipMemAdviseSetCoarseGrain, devIndex));
+#endif
+    }
+
+    // Managed memory may instead be first touched by the CPU, which places its pages in host memory
+    if (memType == MEM_MANAGED && ev.managedFirstTouch)
+    {
+      memset(*memPtr, 0, numBytes);
+    }
+    else
+    {
+      HIP_CALL(hipMemset(*memPtr, 0, numBytes));
+      HIP_CALL(hipDeviceSynchronize());
+    }
   }
   else
   {
-    printf("[ERROR] Unsupported memory type %d\n", memType);
-    exit(1);
+    RunError("Unsupported memory type %d", memType);
   }
 }
 
 void DeallocateMemory(MemType memType, void* memPtr, size_t const bytes)
 {
-  if (memType == MEM_CPU || memType == MEM_CPU_FINE)
+  if (memType == MEM_CPU || memType == MEM_CPU_FINE || memType == MEM_CPU_INTERLV)
   {
     if (memPtr == nullptr)
     {
@@ -1285,7 +2324,24 @@ void DeallocateMemory(MemType memType, void* memPtr, size_t const bytes)
     }
     numa_free(memPtr, bytes);
   }
-  else if (memType == MEM_GPU || memType == MEM_GPU_FINE)
+  else if (memType == MEM_CPU_HUGE || memType == MEM_CPU_USER)
+  {
+    if (memPtr == nullptr)
+    {
+      printf("[ERROR] Attempting to free null registered CPU pointer for %lu bytes.  Skipping hipHostUnregister\n", bytes);
+      return;
+    }
+    HIP_CALL(hipHostUnregister(memPtr));
+    if (memType == MEM_CPU_USER)
+    {
+      free(memPtr);
+    }
+    else
+    {
+      munmap(memPtr, TakeHugePageMapping(memPtr));
+    }
+  }
+  else if (memType == MEM_GPU || memType == MEM_GPU_FINE || memType == MEM_MANAGED)
   {
     if (memPtr == nullptr)
     {
@@ -1296,503 +2352,2528 @@ void DeallocateMemory(MemType memType, void* memPtr, size_t const bytes)
   }
 }
 
-void CheckPages(char* array, size_t numBytes, int targetId)
+// Sizes of huge page mappings by address, shared by all pools
+static std::map<void*, size_t> hugePageMappings;
+static std::mutex              hugePageMappingsMutex;
+
+void AddHugePageMapping(void* memPtr, size_t const mappedBytes)
 {
-  unsigned long const pageSize = getpagesize();
-  unsigned long const numPages = (numBytes + pageSize - 1) / pageSize;
+  std::lock_guard<std::mutex> lock(hugePageMappingsMutex);
+  hugePageMappings[memPtr] = mappedBytes;
+}
+
+size_t TakeHugePageMapping(void* memPtr)
+{
+  std::lock_guard<std::mutex> lock(hugePageMappingsMutex);
+  size_t const mappedBytes = hugePageMappings[memPtr];
+  hugePageMappings.erase(memPtr);
+  return mappedBytes;
+}
+
+thread_local MemPool* selectedMemPool = nullptr;
+
+MemPool& GetMemPool()
+{
+  static MemPool processMemPool;
+  return selectedMemPool ? *selectedMemPool : processMemPool;
+}
+
+void UseMemPool(MemPool* memPool)
+{
+  selectedMemPool = memPool;
+}
 
-  std::vector<void *> pages(numPages);
-  std::vector<int> status(numPages);
+std::set<int>& GetBackgroundLoadDevices()
+{
+  static std::set<int> backgroundLoadDevices;
+  return backgroundLoadDevices;
+}
 
-  pages[0] = array;
-  for (int i = 1; i < numPages; i++)
+hipStream_t GetValidationStream(int const deviceIdx)
+{
+  MemPool& memPool = GetMemPool();
+  std::lock_guard<std::mutex> lock(memPool.mutex);
+  ValidationScratch& scratch = memPool.validation[deviceIdx];
+  if (!scratch.stream)
   {
-    pages[i] = (char*)pages[i-1] + pageSize;
+    HIP_CALL(hipSetDevice(deviceIdx));
+    HIP_CALL(hipStreamCreateWithFlags(&scratch.stream, hipStreamNonBlocking));
   }
+  return scratch.stream;
+}
 
-  long const retCode = move_pages(0, numPages, pages.data(), NULL, status.data(), 0);
-  if (retCode)
+CpuThreadPool& GetCpuThreadPool(EnvVars const& ev, int const numaNode)
+{
+  // Pools persist for the lifetime of the program, and are keyed on the pinning parameters so that
+  // callers using a different CPU_CORE_OFFSET / CPU_CORE_STRIDE get workers pinned accordingly
+  static std::map<std::tuple<int, int, int>, std::unique_ptr<CpuThreadPool>> threadPools;
+  static std::mutex threadPoolsMutex;
+
+  std::lock_guard<std::mutex> lock(threadPoolsMutex);
+  std::unique_ptr<CpuThreadPool>& threadPool = threadPools[std::make_tuple(numaNode, ev.cpuCoreOffset, ev.cpuCoreStride)];
+  if (!threadPool)
+    threadPool.reset(new CpuThreadPool(numaNode, ev.cpuCoreOffset, ev.cpuCoreStride));
+  return *threadPool;
+}
+
+size_t GetSizeClass(size_t const numBytes)
+{
+  // Sizes are rounded up to one of four evenly spaced steps between consecutive powers of 2
+  // This bounds wasted space to 25% while still allowing re-use across nearby sizes
+  size_t const minSizeClass = 4096;
+  if (numBytes <= minSizeClass) return minSizeClass;
+
+  int    const log2Floor = 63 - __builtin_clzll(numBytes - 1);
+  size_t const step      = 1ULL << (log2Floor - 2);
+  return (numBytes + step - 1) / step * step;
+}
+
+void AcquireMemory(EnvVars const& ev, MemType memType, int devIndex, size_t numBytes, void** memPtr)
+{
+  if (!ev.useMemPool)
   {
-    printf("[ERROR] Unable to collect page info\n");
-    exit(1);
+    AllocateMemory(ev, memType, devIndex, numBytes, memPtr);
+    return;
   }
 
-  size_t mistakeCount = 0;
-  for (int i = 0; i < numPages; i++)
+  MemPool& memPool = GetMemPool();
+  std::lock_guard<std::mutex> lock(memPool.mutex);
+  MemPoolKey key = std::make_tuple(memType, devIndex, GetSizeClass(numBytes));
+
+  // Fall back to the smallest free buffer of a larger size class for the same memory, so that varying sizes
+  // (e.g. SWEEP_RAND_BYTES) use sub-ranges of buffers that were already allocated instead of growing the pool
+  auto it = memPool.freeBuffers.lower_bound(key);
+  while (it != memPool.freeBuffers.end() && std::get<0>(it->first) == memType &&
+         std::get<1>(it->first) == devIndex && it->second.empty())
+    ++it;
+  bool const hasFreeBuffer = (it != memPool.freeBuffers.end() && std::get<0>(it->first) == memType &&
+                              std::get<1>(it->first) == devIndex);
+
+  if (!hasFreeBuffer)
   {
-    if (status[i] < 0)
+    // Idle buffers of the same memory are all too small to be re-used here.  Free them first, so that Tests touching
+    // many size classes (e.g. growing sizes) do not keep every size class allocated and run out of memory
+    auto const firstIt = memPool.freeBuffers.lower_bound(std::make_tuple(memType, devIndex, (size_t)0));
+    for (auto smallIt = firstIt; smallIt != it; ++smallIt)
     {
-      printf("[ERROR] Unexpected page status %d for page %d\n", status[i], i);
-      exit(1);
+      for (void* smallPtr : smallIt->second)
+        DeallocateMemory(memType, smallPtr, std::get<2>(smallIt->first));
+      smallIt->second.clear();
     }
-    if (status[i] != targetId) mistakeCount++;
+
+    // Allocate the full size class so that this allocation may be re-used by other sizes within the class
+    AllocateMemory(ev, memType, devIndex, std::get<2>(key), memPtr);
   }
-  if (mistakeCount > 0)
+  else
   {
-    printf("[ERROR] %lu out of %lu pages for memory allocation were not on NUMA node %d\n", mistakeCount, numPages, targetId);
-    exit(1);
+    key = it->first;
+    *memPtr = it->second.back();
+    it->second.pop_back();
+
+    // Clear re-used memory so that stale results from previous Tests cannot pass validation
+    if (IsCpuType(memType) || (memType == MEM_MANAGED && ev.managedFirstTouch))
+    {
+      memset(*memPtr, 0, numBytes);
+    }
+    else
+    {
+      HIP_CALL(hipSetDevice(devIndex));
+      HIP_CALL(hipMemset(*memPtr, 0, numBytes));
+      HIP_CALL(hipDeviceSynchronize());
+    }
   }
+  memPool.usedBuffers[*memPtr] = key;
 }
 
-uint32_t GetId(uint32_t hwId)
+void ReleaseMemory(EnvVars const& ev, MemType memType, void* memPtr, size_t const numBytes)
 {
-  // Based on instinct-mi200-cdna2-instruction-set-architecture.pdf
-  int const shId = (hwId >> 12) &  1;
-  int const cuId = (hwId >>  8) & 15;
-  int const seId = (hwId >> 13) &  3;
-  return (shId << 5) + (cuId << 2) + seId;
+  if (!ev.useMemPool)
+  {
+    DeallocateMemory(memType, memPtr, numBytes);
+    return;
+  }
+
+  MemPool& memPool = GetMemPool();
+  std::lock_guard<std::mutex> lock(memPool.mutex);
+  auto it = memPool.usedBuffers.find(memPtr);
+  if (it == memPool.usedBuffers.end())
+  {
+    RunError("Attempting to release pointer %p that was not allocated from memory pool", memPtr);
+  }
+  memPool.freeBuffers[it->second].push_back(memPtr);
+  memPool.usedBuffers.erase(it);
 }
 
-void RunTransfer(EnvVars const& ev, int const iteration,
-                 ExecutorInfo& exeInfo, int const transferIdx)
+void AcquireStreams(EnvVars const& ev, int const deviceIdx, int const numStreams, ExecutorInfo& exeInfo)
 {
-  Transfer* transfer = exeInfo.transfers[transferIdx];
-
-  if (transfer->exeType == EXE_GPU_GFX)
-  {
-    // Switch to executing GPU
-    int const exeIndex = RemappedIndex(transfer->exeIndex, false);
-    HIP_CALL(hipSetDevice(exeIndex));
+  MemPool& memPool = GetMemPool();
 
-    hipStream_t& stream     = exeInfo.streams[transferIdx];
-    hipEvent_t&  startEvent = exeInfo.startEvents[transferIdx];
-    hipEvent_t&  stopEvent  = exeInfo.stopEvents[transferIdx];
+  exeInfo.streams.clear();
+  exeInfo.startEvents.clear();
+  exeInfo.stopEvents.clear();
 
-    // Figure out how many threadblocks to use.
-    // In single stream mode, all the threadblocks for this GPU are launched
-    // Otherwise, just launch the threadblocks associated with this single Transfer
-    int const numBlocksToRun = ev.useSingleStream ? exeInfo.totalSubExecs : transfer->numSubExecs;
-    int const numXCCs = (ev.useXccFilter ? ev.xccIdsPerDevice[exeIndex].size() : 1);
+  // Each stream gets a pair of events per parameter slice (stream s uses events [s * #slices, (s + 1) * #slices)),
+  // so that async launches re-use the same events for every batch of iterations
+  size_t const numEvents = numStreams * NumParamSlices(ev);
 
-#if defined(__NVCC__)
-    HIP_CALL(hipEventRecord(startEvent, stream));
-    GpuKernelTable[ev.gpuKernel]<<<numBlocksToRun, ev.blockSize, ev.sharedMemBytes, stream>>>(transfer->subExecParamGpuPtr);
-    HIP_CALL(hipEventRecord(stopEvent, stream));
-#else
-    hipExtLaunchKernelGGL(GpuKernelTable[ev.gpuKernel],
-                          dim3(numXCCs, numBlocksToRun, 1),
-                          dim3(ev.blockSize, 1, 1),
-                          ev.sharedMemBytes, stream,
-                          startEvent, stopEvent,
-                          0, transfer->subExecParamGpuPtr);
-#endif
-    // Synchronize per iteration, unless in single sync mode, in which case
-    // synchronize during last warmup / last actual iteration
-    HIP_CALL(hipStreamSynchronize(stream));
-
-    if (iteration >= 0)
+  // Take streams / events out of the pool for this device if enabled (so that executors sharing a device
+  // do not share streams), otherwise construct new ones
+  if (ev.useMemPool)
+  {
+    std::lock_guard<std::mutex> lock(memPool.mutex);
+    std::vector<hipStream_t>& streams     = memPool.streams[deviceIdx];
+    std::vector<hipEvent_t>&  startEvents = memPool.startEvents[deviceIdx];
+    std::vector<hipEvent_t>&  stopEvents  = memPool.stopEvents[deviceIdx];
+    while (exeInfo.streams.size() < numStreams && !streams.empty())
     {
-      // Record GPU timing
-      float gpuDeltaMsec;
-      HIP_CALL(hipEventElapsedTime(&gpuDeltaMsec, startEvent, stopEvent));
-
-      if (ev.useSingleStream)
-      {
-        // Figure out individual timings for Transfers that were all launched together
-        for (Transfer* currTransfer : exeInfo.transfers)
-        {
-          long long minStartCycle = std::numeric_limits<long long>::max();
-          long long maxStopCycle  = std::numeric_limits<long long>::min();
-
-          std::set<std::pair<int,int>> CUs;
-          for (auto subExecIdx : currTransfer->subExecIdx)
-          {
-            minStartCycle = std::min(minStartCycle, exeInfo.subExecParamGpu[subExecIdx].startCycle);
-            maxStopCycle  = std::max(maxStopCycle,  exeInfo.subExecParamGpu[subExecIdx].stopCycle);
-            if (ev.showIterations)
-              CUs.insert(std::make_pair(exeInfo.subExecParamGpu[subExecIdx].xccId,
-                                        GetId(exeInfo.subExecParamGpu[subExecIdx].hwId)));
-          }
-          int const wallClockRate = ev.wallClockPerDeviceMhz[exeIndex];
-          double iterationTimeMs = (maxStopCycle - minStartCycle) / (double)(wallClockRate);
-          currTransfer->transferTime += iterationTimeMs;
-          if (ev.showIterations)
-          {
-            currTransfer->perIterationTime.push_back(iterationTimeMs);
-            currTransfer->perIterationCUs.push_back(CUs);
-          }
-        }
-        exeInfo.totalTime += gpuDeltaMsec;
-      }
-      else
-      {
-        transfer->transferTime += gpuDeltaMsec;
-        if (ev.showIterations)
-        {
-          transfer->perIterationTime.push_back(gpuDeltaMsec);
-          std::set<std::pair<int,int>> CUs;
-          for (int i = 0; i < transfer->numSubExecs; i++)
-            CUs.insert(std::make_pair(transfer->subExecParamGpuPtr[i].xccId,
-                                      GetId(transfer->subExecParamGpuPtr[i].hwId)));
-          transfer->perIterationCUs.push_back(CUs);
-        }
-      }
+      exeInfo.streams.push_back(streams.back()); streams.pop_back();
+    }
+    while (exeInfo.startEvents.size() < numEvents && !startEvents.empty())
+    {
+      exeInfo.startEvents.push_back(startEvents.back()); startEvents.pop_back();
+      exeInfo.stopEvents.push_back(stopEvents.back());   stopEvents.pop_back();
     }
   }
-  else if (transfer->exeType == EXE_GPU_DMA)
-  {
-    // Switch to executing GPU
-    int const exeIndex = RemappedIndex(transfer->exeIndex, false);
-    HIP_CALL(hipSetDevice(exeIndex));
 
-    hipStream_t& stream     = exeInfo.streams[transferIdx];
-    hipEvent_t&  startEvent = exeInfo.startEvents[transferIdx];
-    hipEvent_t&  stopEvent  = exeInfo.stopEvents[transferIdx];
-
-    HIP_CALL(hipEventRecord(startEvent, stream));
-    if (transfer->numSrcs == 0 && transfer->numDsts == 1)
+  HIP_CALL(hipSetDevice(deviceIdx));
+  while (exeInfo.streams.size() < numStreams)
+  {
+    hipStream_t stream;
+    if (ev.cuMask.size())
     {
-      HIP_CALL(hipMemsetAsync(transfer->dstMem[0],
-                              MEMSET_CHAR, transfer->numBytesActual, stream));
+#if !defined(__NVCC__)
+      HIP_CALL(hipExtStreamCreateWithCUMask(&stream, ev.cuMask.size(), ev.cuMask.data()));
+#endif
     }
-    else if (transfer->numSrcs == 1 && transfer->numDsts == 1)
+    else
     {
-      HIP_CALL(hipMemcpyAsync(transfer->dstMem[0], transfer->srcMem[0],
-                              transfer->numBytesActual, hipMemcpyDefault,
-                              stream));
+      HIP_CALL(hipStreamCreate(&stream));
     }
-    HIP_CALL(hipEventRecord(stopEvent, stream));
-    HIP_CALL(hipStreamSynchronize(stream));
+    exeInfo.streams.push_back(stream);
+  }
+  while (exeInfo.startEvents.size() < numEvents)
+  {
+    hipEvent_t startEvent, stopEvent;
+    HIP_CALL(hipEventCreate(&startEvent));
+    HIP_CALL(hipEventCreate(&stopEvent));
+    exeInfo.startEvents.push_back(startEvent);
+    exeInfo.stopEvents.push_back(stopEvent);
+  }
+}
 
-    if (iteration >= 0)
+void ReleaseStreams(EnvVars const& ev, int const deviceIdx, ExecutorInfo& exeInfo)
+{
+  // Pooled streams are returned to the pool, and only destroyed by ReleasePooledResources
+  if (ev.useMemPool)
+  {
+    MemPool& memPool = GetMemPool();
+    std::lock_guard<std::mutex> lock(memPool.mutex);
+    memPool.streams[deviceIdx].insert(memPool.streams[deviceIdx].end(),
+                                      exeInfo.streams.begin(), exeInfo.streams.end());
+    memPool.startEvents[deviceIdx].insert(memPool.startEvents[deviceIdx].end(),
+                                          exeInfo.startEvents.begin(), exeInfo.startEvents.end());
+    memPool.stopEvents[deviceIdx].insert(memPool.stopEvents[deviceIdx].end(),
+                                         exeInfo.stopEvents.begin(), exeInfo.stopEvents.end());
+  }
+  else
+  {
+    for (size_t i = 0; i < exeInfo.startEvents.size(); ++i)
     {
-      // Record GPU timing
-      float gpuDeltaMsec;
-      HIP_CALL(hipEventElapsedTime(&gpuDeltaMsec, startEvent, stopEvent));
-      transfer->transferTime += gpuDeltaMsec;
-      if (ev.showIterations)
-        transfer->perIterationTime.push_back(gpuDeltaMsec);
+      HIP_CALL(hipEventDestroy(exeInfo.startEvents[i]));
+      HIP_CALL(hipEventDestroy(exeInfo.stopEvents[i]));
     }
+    for (hipStream_t stream : exeInfo.streams)
+      HIP_CALL(hipStreamDestroy(stream));
   }
-  else if (transfer->exeType == EXE_CPU) // CPU execution agent
+  exeInfo.streams.clear();
+  exeInfo.startEvents.clear();
+  exeInfo.stopEvents.clear();
+}
+
+void ReleasePooledResources()
+{
+  MemPool& memPool = GetMemPool();
+  std::lock_guard<std::mutex> lock(memPool.mutex);
+
+  if (!memPool.usedBuffers.empty())
+    printf("[WARN] %lu pooled allocation(s) still in use during release\n", memPool.usedBuffers.size());
+  for (auto const& usedPair : memPool.usedBuffers)
+    memPool.freeBuffers[usedPair.second].push_back(usedPair.first);
+  memPool.usedBuffers.clear();
+
+  for (auto& freePair : memPool.freeBuffers)
   {
-    // Force this thread and all child threads onto correct NUMA node
-    int const exeIndex = RemappedIndex(transfer->exeIndex, true);
-    if (numa_run_on_node(exeIndex))
+    MemType const memType  = std::get<0>(freePair.first);
+    size_t  const numBytes = std::get<2>(freePair.first);
+    for (void* memPtr : freePair.second)
+      DeallocateMemory(memType, memPtr, numBytes);
+  }
+  memPool.freeBuffers.clear();
+
+  for (auto& streamPair : memPool.streams)
+  {
+    HIP_CALL(hipSetDevice(streamPair.first));
+    for (hipStream_t stream : streamPair.second)
+      HIP_CALL(hipStreamDestroy(stream));
+  }
+  for (auto& eventPair : memPool.startEvents)
+  {
+    int const deviceIdx = eventPair.first;
+    HIP_CALL(hipSetDevice(deviceIdx));
+    for (size_t i = 0; i < eventPair.second.size(); ++i)
     {
-      printf("[ERROR] Unable to set CPU to NUMA node %d\n", exeIndex);
-      exit(1);
+      HIP_CALL(hipEventDestroy(memPool.startEvents[deviceIdx][i]));
+      HIP_CALL(hipEventDestroy(memPool.stopEvents[deviceIdx][i]));
     }
+  }
+  memPool.streams.clear();
+  memPool.startEvents.clear();
+  memPool.stopEvents.clear();
 
-    std::vector<std::thread> childThreads;
-
-    auto cpuStart = std::chrono::high_resolution_clock::now();
+  for (auto& scratchPair : memPool.validation)
+  {
+    HIP_CALL(hipSetDevice(scratchPair.first));
+    if (scratchPair.second.devResults) HIP_CALL(hipFree(scratchPair.second.devResults));
+    if (scratchPair.second.devPattern) HIP_CALL(hipFree(scratchPair.second.devPattern));
+    if (scratchPair.second.stream)     HIP_CALL(hipStreamDestroy(scratchPair.second.stream));
+  }
+  memPool.validation.clear();
+}
 
-    // Launch each subExecutor in child-threads to perform memcopies
-    for (int i = 0; i < transfer->numSubExecs; ++i)
-      childThreads.push_back(std::thread(CpuReduceKernel, std::ref(transfer->subExecParam[i])));
+void CheckPages(char* array, size_t numBytes, int targetId)
+{
+  unsigned long const pageSize = getpagesize();
+  unsigned long const numPages = (numBytes + pageSize - 1) / pageSize;
 
-    // Wait for child-threads to finish
-    for (int i = 0; i < transfer->numSubExecs; ++i)
-      childThreads[i].join();
+  // Large allocations only have an evenly spaced sample of their pages checked (always including the last page)
+  unsigned long const numChecked = std::min(numPages, (unsigned long)MAX_CHECKED_PAGES);
+  std::vector<void *> pages(numChecked);
+  std::vector<int> status(numChecked);
+  for (unsigned long i = 0; i < numChecked; i++)
+  {
+    unsigned long const pageIdx = (numChecked == 1) ? 0 : i * (numPages - 1) / (numChecked - 1);
+    pages[i] = array + pageIdx * pageSize;
+  }
 
-    auto cpuDelta = std::chrono::high_resolution_clock::now() - cpuStart;
+  long const retCode = move_pages(0, numChecked, pages.data(), NULL, status.data(), 0);
+  if (retCode)
+  {
+    RunError("Unable to collect page info");
+  }
 
-    // Record time if not a warmup iteration
-    if (iteration >= 0)
+  // A negative targetId only checks that pages are resident (e.g. for interleaved memory)
+  size_t mistakeCount = 0;
+  for (unsigned long i = 0; i < numChecked; i++)
+  {
+    if (status[i] < 0)
     {
-      double const delta = (std::chrono::duration_cast<std::chrono::duration<double>>(cpuDelta).count() * 1000.0);
-      transfer->transferTime += delta;
-      if (ev.showIterations)
-        transfer->perIterationTime.push_back(delta);
+      RunError("Unexpected page status %d for page at offset %lu", status[i], (char*)pages[i] - array);
     }
+    if (targetId >= 0 && status[i] != targetId) mistakeCount++;
+  }
+  if (mistakeCount > 0)
+  {
+    RunError("%lu out of %lu checked pages for memory allocation were not on NUMA node %d", mistakeCount, numChecked, targetId);
   }
 }
 
-void RunPeerToPeerBenchmarks(EnvVars const& ev, size_t N)
+void PrefetchManagedMemory(EnvVars const& ev, Transfer const& transfer)
 {
-  ev.DisplayP2PBenchmarkEnvVars();
-
-  char const separator = ev.outputToCsv ? ',' : ' ';
-  printf("Bytes Per Direction%c%lu\n", separator, N * sizeof(float));
+  if (ev.managedPrefetch == 0) return;
 
-  // Collect the number of available CPUs/GPUs on this machine
-  int const numCpus    = ev.numCpuDevices;
-  int const numGpus    = ev.numGpuDevices;
-  int const numDevices = numCpus + numGpus;
+  size_t const numBytes = transfer.numBytesActual + ev.byteOffset;
+  for (int j = 0; j < transfer.numSrcs + transfer.numDsts; j++)
+  {
+    bool const isSrc  = (j < transfer.numSrcs);
+    int  const memIdx = isSrc ? j : j - transfer.numSrcs;
+    if ((isSrc ? transfer.srcType[memIdx] : transfer.dstType[memIdx]) != MEM_MANAGED) continue;
+
+    int const deviceIdx = isSrc ? transfer.SrcDevice(memIdx) : transfer.DstDevice(memIdx);
+    HIP_CALL(hipSetDevice(deviceIdx));
+    HIP_CALL(hipMemPrefetchAsync(isSrc ? transfer.srcMem[memIdx] : transfer.dstMem[memIdx], numBytes,
+                                 ev.managedPrefetch == 1 ? deviceIdx : hipCpuDeviceId, 0));
+    HIP_CALL(hipDeviceSynchronize());
+  }
+}
 
-  // Enable peer to peer for each GPU
-  for (int i = 0; i < numGpus; i++)
-    for (int j = 0; j < numGpus; j++)
-      if (i != j) EnablePeerAccess(i, j);
+uint32_t GetId(uint32_t hwId)
+{
+  // Based on instinct-mi200-cdna2-instruction-set-architecture.pdf
+  int const shId = (hwId >> 12) &  1;
+  int const cuId = (hwId >>  8) & 15;
+  int const seId = (hwId >> 13) &  3;
+  return (shId << 5) + (cuId << 2) + seId;
+}
 
-  // Perform unidirectional / bidirectional
-  for (int isBidirectional = 0; isBidirectional <= 1; isBidirectional++)
+void LaunchGfxTransfer(EnvVars const& ev, ExecutorInfo& exeInfo, int const transferIdx, int const slice,
+                       hipEvent_t startEvent, hipEvent_t stopEvent)
+{
+  Transfer*    transfer = exeInfo.transfers[transferIdx];
+  int const    exeIndex = RemappedIndex(transfer->exeIndex, false);
+  hipStream_t& stream   = exeInfo.streams[transferIdx];
+
+  // Figure out how many threadblocks to use.
+  // In single stream mode, all the threadblocks for this GPU are launched
+  // Otherwise, just launch the threadblocks associated with this single Transfer
+  // With wavefront granularity, each threadblock executes multiple subExecutors
+  int const numSubExecsToRun = ev.useSingleStream ? exeInfo.totalSubExecs : transfer->numSubExecs;
+  int const subExecsPerBlock = ev.useWaveSubExec ? ev.blockSize / WARP_SIZE : 1;
+  int const numBlocksToRun   = RoundUp(numSubExecsToRun, subExecsPerBlock) / subExecsPerBlock;
+  int const numXCCs = (ev.useXccFilter ? ev.xccIdsPerDevice[exeIndex].size() : 1);
+
+  GpuKernelFuncPtr gpuKernel = (ev.useWaveSubExec ? GpuWaveKernelTable : GpuKernelTable)[ev.dataType][ev.nativeAccum][ev.gpuKernel];
+
+  // Switch to the kernel specialized for the Transfer shape (which all Transfers in a single stream must share)
+  // Specializations only exist for the default 8x unroll
+  if (ev.useShapeKernels && (ev.gpuKernel == 0 || ev.gpuKernel == 8))
   {
-    if (ev.p2pMode == 1 && isBidirectional == 1 ||
-        ev.p2pMode == 2 && isBidirectional == 0) continue;
+    int shape = GetGpuShape(transfer->numSrcs, transfer->numDsts);
+    if (ev.useSingleStream)
+      for (Transfer const* currTransfer : exeInfo.transfers)
+        if (GetGpuShape(currTransfer->numSrcs, currTransfer->numDsts) != shape) shape = -1;
+    if (shape != -1)
+      gpuKernel = (ev.useWaveSubExec ? GpuWaveShapeKernelTable : GpuShapeKernelTable)[ev.dataType][ev.nativeAccum][shape];
+  }
 
-    printf("%sdirectional copy peak bandwidth GB/s [%s read / %s write] (GPU-Executor: %s)\n", isBidirectional ? "Bi" : "Uni",
-           ev.useRemoteRead ? "Remote" : "Local",
-           ev.useRemoteRead ? "Local" : "Remote",
-           ev.useDmaCopy    ? "DMA"   : "GFX");
+  // Each slice holds an independent copy of the subExecutor parameters for the executor
+  SubExecParam* subExecParamGpuPtr = transfer->subExecParamGpuPtr + slice * exeInfo.numSubExecSlots;
 
-    // Print header
-    if (isBidirectional)
-    {
-      printf("%12s", "SRC\\DST");
-    }
-    else
-    {
-      if (ev.useRemoteRead)
-        printf("%12s", "SRC\\EXE+DST");
-      else
-        printf("%12s", "SRC+EXE\\DST");
-    }
-    if (ev.outputToCsv) printf(",");
-    for (int i = 0; i < numCpus; i++)
+#if defined(__NVCC__)
+  // Events are omitted while capturing into a graph
+  if (startEvent) HIP_CALL(hipEventRecord(startEvent, stream));
+  gpuKernel<<<numBlocksToRun, ev.blockSize, ev.sharedMemBytes, stream>>>(subExecParamGpuPtr);
+  if (stopEvent)  HIP_CALL(hipEventRecord(stopEvent, stream));
+#else
+  hipExtLaunchKernelGGL(gpuKernel,
+                        dim3(numXCCs, numBlocksToRun, 1),
+                        dim3(ev.blockSize, 1, 1),
+                        ev.sharedMemBytes, stream,
+                        startEvent, stopEvent,
+                        0, subExecParamGpuPtr);
+#endif
+}
+
+void RecordGfxTiming(EnvVars const& ev, ExecutorInfo& exeInfo, int const transferIdx, int const slice,
+                     hipEvent_t startEvent, hipEvent_t stopEvent)
+{
+  Transfer* transfer = exeInfo.transfers[transferIdx];
+  int const exeIndex = RemappedIndex(transfer->exeIndex, false);
+
+  // Record GPU timing
+  float gpuDeltaMsec;
+  HIP_CALL(hipEventElapsedTime(&gpuDeltaMsec, startEvent, stopEvent));
+
+  if (ev.useSingleStream)
+  {
+    SubExecParam const* subExecParam = exeInfo.subExecParamGpu + slice * exeInfo.numSubExecSlots;
+
+    // Figure out individual timings for Transfers that were all launched together
+    for (Transfer* currTransfer : exeInfo.transfers)
     {
-      printf("%7s %02d", "CPU", i);
-      if (ev.outputToCsv) printf(",");
+      long long minStartCycle = std::numeric_limits<long long>::max();
+      long long maxStopCycle  = std::numeric_limits<long long>::min();
+
+      std::set<std::pair<int,int>> CUs;
+      for (auto subExecIdx : currTransfer->subExecIdx)
+      {
+        minStartCycle = std::min(minStartCycle, subExecParam[subExecIdx].startCycle);
+        maxStopCycle  = std::max(maxStopCycle,  subExecParam[subExecIdx].stopCycle);
+        if (ev.showIterations)
+          CUs.insert(std::make_pair(subExecParam[subExecIdx].xccId,
+                                    GetId(subExecParam[subExecIdx].hwId)));
+      }
+      for (int i = 0; i < currTransfer->numChunksPerSubExec.size(); i++)
+        currTransfer->numChunksPerSubExec[i] += subExecParam[currTransfer->subExecIdx[i]].numChunks;
+      int const wallClockRate = ev.wallClockPerDeviceMhz[exeIndex];
+      double iterationTimeMs = (maxStopCycle - minStartCycle) / (double)(wallClockRate);
+      currTransfer->transferTime += iterationTimeMs;
+      currTransfer->latencyHistogram.Add(iterationTimeMs);
+      if (ev.showIterations)
+      {
+        currTransfer->perIterationTime.push_back(iterationTimeMs);
+        currTransfer->perIterationCUs.push_back(CUs);
+      }
     }
-    if (numCpus > 0) printf("   ");
-    for (int i = 0; i < numGpus; i++)
+    exeInfo.totalTime += gpuDeltaMsec;
+    exeInfo.latencyHistogram.Add(gpuDeltaMsec);
+  }
+  else
+  {
+    SubExecParam const* subExecParam = transfer->subExecParamGpuPtr + slice * exeInfo.numSubExecSlots;
+
+    transfer->transferTime += gpuDeltaMsec;
+    transfer->latencyHistogram.Add(gpuDeltaMsec);
+    for (int i = 0; i < transfer->numChunksPerSubExec.size(); i++)
+      transfer->numChunksPerSubExec[i] += subExecParam[i].numChunks;
+    if (ev.showIterations)
     {
-      printf("%7s %02d", "GPU", i);
-      if (ev.outputToCsv) printf(",");
+      transfer->perIterationTime.push_back(gpuDeltaMsec);
+      std::set<std::pair<int,int>> CUs;
+      for (int i = 0; i < transfer->numSubExecs; i++)
+        CUs.insert(std::make_pair(subExecParam[i].xccId,
+                                  GetId(subExecParam[i].hwId)));
+      transfer->perIterationCUs.push_back(CUs);
     }
-    printf("\n");
+  }
+}
 
-    double avgBwSum[2][2] = {};
-    int    avgCount[2][2] = {};
+void LaunchDmaTransfer(ExecutorInfo& exeInfo, int const transferIdx,
+                       hipEvent_t startEvent, hipEvent_t stopEvent)
+{
+  Transfer*    transfer = exeInfo.transfers[transferIdx];
+  hipStream_t& stream   = exeInfo.streams[transferIdx];
 
-    ExeType const gpuExeType = ev.useDmaCopy ? EXE_GPU_DMA : EXE_GPU_GFX;
-    // Loop over all possible src/dst pairs
-    for (int src = 0; src < numDevices; src++)
-    {
-      MemType const srcType  = (src < numCpus ? MEM_CPU : MEM_GPU);
-      int     const srcIndex = (srcType == MEM_CPU ? src : src - numCpus);
-      MemType const srcTypeActual = ((ev.useFineGrain && srcType == MEM_CPU) ? MEM_CPU_FINE :
-                                     (ev.useFineGrain && srcType == MEM_GPU) ? MEM_GPU_FINE :
-                                                                               srcType);
-      std::vector<std::vector<double>> avgBandwidth(isBidirectional + 1);
-      std::vector<std::vector<double>> minBandwidth(isBidirectional + 1);
-      std::vector<std::vector<double>> maxBandwidth(isBidirectional + 1);
-      std::vector<std::vector<double>> stdDev(isBidirectional + 1);
+  // Events are omitted while capturing into a graph
+  if (startEvent) HIP_CALL(hipEventRecord(startEvent, stream));
+  if (transfer->numSrcs == 0 && transfer->numDsts == 1)
+  {
+    HIP_CALL(hipMemsetAsync(transfer->dstMem[0],
+                            MEMSET_CHAR, transfer->numBytesActual, stream));
+  }
+  else if (transfer->numSrcs == 1 && transfer->numDsts == 1)
+  {
+    HIP_CALL(hipMemcpyAsync(transfer->dstMem[0], transfer->srcMem[0],
+                            transfer->numBytesActual, hipMemcpyDefault,
+                            stream));
+  }
+  if (stopEvent) HIP_CALL(hipEventRecord(stopEvent, stream));
+}
 
-      if (src == numCpus && src != 0) printf("\n");
-      for (int dst = 0; dst < numDevices; dst++)
-      {
-        MemType const dstType  = (dst < numCpus ? MEM_CPU : MEM_GPU);
-        int     const dstIndex = (dstType == MEM_CPU ? dst : dst - numCpus);
-        MemType const dstTypeActual = ((ev.useFineGrain && dstType == MEM_CPU) ? MEM_CPU_FINE :
-                                       (ev.useFineGrain && dstType == MEM_GPU) ? MEM_GPU_FINE :
-                                                                                 dstType);
-        // Prepare Transfers
-        std::vector<Transfer> transfers(isBidirectional + 1);
+void LaunchGpuTransfer(EnvVars const& ev, ExecutorInfo& exeInfo, int const transferIdx, int const slice,
+                       hipEvent_t startEvent, hipEvent_t stopEvent)
+{
+  Transfer* transfer = exeInfo.transfers[transferIdx];
 
-        // SRC -> DST
-        transfers[0].numBytes = N * sizeof(float);
-        transfers[0].srcType.push_back(srcTypeActual);
-        transfers[0].dstType.push_back(dstTypeActual);
-        transfers[0].srcIndex.push_back(srcIndex);
-        transfers[0].dstIndex.push_back(dstIndex);
-        transfers[0].numSrcs = transfers[0].numDsts = 1;
-        transfers[0].exeType = IsGpuType(ev.useRemoteRead ? dstType : srcType) ? gpuExeType : EXE_CPU;
-        transfers[0].exeIndex = (ev.useRemoteRead ? dstIndex : srcIndex);
-        transfers[0].numSubExecs = IsGpuType(transfers[0].exeType) ? ev.numGpuSubExecs : ev.numCpuSubExecs;
+  if (ev.useHipGraph)
+  {
+    // Replay the captured graph for this stream (DMA executors only have a single graph per stream)
+    hipStream_t& stream   = exeInfo.streams[transferIdx];
+    int const    graphIdx = (transfer->exeType == EXE_GPU_GFX ? slice : 0);
 
-        // DST -> SRC
-        if (isBidirectional)
-        {
-          transfers[1].numBytes = N * sizeof(float);
-          transfers[1].numSrcs = transfers[1].numDsts = 1;
-          transfers[1].srcType.push_back(dstTypeActual);
-          transfers[1].dstType.push_back(srcTypeActual);
-          transfers[1].srcIndex.push_back(dstIndex);
-          transfers[1].dstIndex.push_back(srcIndex);
-          transfers[1].exeType = IsGpuType(ev.useRemoteRead ? srcType : dstType) ? gpuExeType : EXE_CPU;
-          transfers[1].exeIndex = (ev.useRemoteRead ? srcIndex : dstIndex);
-          transfers[1].numSubExecs = IsGpuType(transfers[1].exeType) ? ev.numGpuSubExecs : ev.numCpuSubExecs;
-        }
+    HIP_CALL(hipEventRecord(startEvent, stream));
+    HIP_CALL(hipGraphLaunch(exeInfo.graphExecs[transferIdx][graphIdx], stream));
+    HIP_CALL(hipEventRecord(stopEvent, stream));
+  }
+  else if (transfer->exeType == EXE_GPU_GFX)
+    LaunchGfxTransfer(ev, exeInfo, transferIdx, slice, startEvent, stopEvent);
+  else
+    LaunchDmaTransfer(exeInfo, transferIdx, startEvent, stopEvent);
+}
 
-        bool skipTest = false;
+void CaptureGraphs(EnvVars const& ev, ExeType const exeType, int const exeIndex, ExecutorInfo& exeInfo)
+{
+  HIP_CALL(hipSetDevice(exeIndex));
 
-        // Abort if executing on NUMA node with no CPUs
-        for (int i = 0; i <= isBidirectional; i++)
-        {
-          if (transfers[i].exeType == EXE_CPU && ev.numCpusPerNuma[transfers[i].exeIndex] == 0)
-          {
-            skipTest = true;
-            break;
-          }
+  // GFX executors require one graph per copy of subExecutor parameters.  Async launches cycle through the same
+  // bounded set of slices every batch, so at most MAX_ASYNC_PARAM_SLICES graphs are instantiated per stream
+  int const numSlices  = (exeType == EXE_GPU_GFX ? NumParamSlices(ev) : 1);
+  int const numStreams = exeInfo.streams.size();
 
-#if defined(__NVCC__)
-          // NVIDIA platform cannot access GPU memory directly from CPU executors
-          if (transfers[i].exeType == EXE_CPU && (IsGpuType(srcType) || IsGpuType(dstType)))
-          {
-            skipTest = true;
-            break;
-          }
-#endif
-        }
+  exeInfo.graphExecs.resize(numStreams);
+  for (int i = 0; i < numStreams; i++)
+  {
+    hipStream_t& stream = exeInfo.streams[i];
+    for (int slice = 0; slice < numSlices; slice++)
+    {
+      hipGraph_t     graph;
+      hipGraphExec_t graphExec;
 
-        if (isBidirectional && srcType == dstType && srcIndex == dstIndex) skipTest = true;
+      HIP_CALL(hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal));
+      if (exeType == EXE_GPU_GFX)
+        LaunchGfxTransfer(ev, exeInfo, i, slice, NULL, NULL);
+      else
+        LaunchDmaTransfer(exeInfo, i, NULL, NULL);
+      HIP_CALL(hipStreamEndCapture(stream, &graph));
 
-        if (!skipTest)
+      HIP_CALL(hipGraphInstantiateWithFlags(&graphExec, graph, 0));
+      HIP_CALL(hipGraphDestroy(graph));
+      exeInfo.graphExecs[i].push_back(graphExec);
+    }
+  }
+}
+
+void DestroyGraphs(ExecutorInfo& exeInfo)
+{
+  for (auto& graphExecs : exeInfo.graphExecs)
+    for (auto graphExec : graphExecs)
+      HIP_CALL(hipGraphExecDestroy(graphExec));
+  exeInfo.graphExecs.clear();
+}
+
+void RecordDmaTiming(EnvVars const& ev, ExecutorInfo& exeInfo, int const transferIdx,
+                     hipEvent_t startEvent, hipEvent_t stopEvent)
+{
+  Transfer* transfer = exeInfo.transfers[transferIdx];
+
+  // Record GPU timing
+  float gpuDeltaMsec;
+  HIP_CALL(hipEventElapsedTime(&gpuDeltaMsec, startEvent, stopEvent));
+  transfer->transferTime += gpuDeltaMsec;
+  transfer->latencyHistogram.Add(gpuDeltaMsec);
+  if (ev.showIterations)
+    transfer->perIterationTime.push_back(gpuDeltaMsec);
+}
+
+void PrepareHsaDmaTransfer(Transfer& transfer, int& nextEngine)
+{
+#if !defined(__NVCC__)
+  // Copy timestamps are used for timing (instead of HIP events)
+  static bool isProfilingEnabled = false;
+  if (!isProfilingEnabled)
+  {
+    HSA_CHECK(hsa_amd_profiling_async_copy_enable(true));
+    isProfilingEnabled = true;
+  }
+
+  // Determine agents owning src / dst memory (memset Transfers are executed through HIP instead)
+  if (transfer.numSrcs != 1) return;
+  AgentData& agentData = GetAgentData();
+  transfer.dmaSrcAgent = IsCpuType(transfer.srcType[0]) ? agentData.cpuAgents[RemappedIndex(transfer.srcIndex[0], true)]
+                                                        : agentData.gpuAgents[transfer.SrcDevice(0)];
+  transfer.dmaDstAgent = IsCpuType(transfer.dstType[0]) ? agentData.cpuAgents[RemappedIndex(transfer.dstIndex[0], true)]
+                                                        : agentData.gpuAgents[transfer.DstDevice(0)];
+
+  // The copy is performed by the source GPU (or the destination GPU if the source is host memory)
+  int const copyDevice = IsGpuType(transfer.srcType[0]) ? transfer.SrcDevice(0) : transfer.DstDevice(0);
+  if (copyDevice != RemappedIndex(transfer.exeIndex, false))
+  {
+    InputError("Transfer %d: With USE_HSA_DMA, the DMA executor must be the source GPU (or destination GPU for host sources)",
+               transfer.transferIndex);
+  }
+
+  // Collect SDMA engines capable of copying between the two agents
+  uint32_t engineIdMask = 0;
+  HSA_CHECK(hsa_amd_memory_copy_engine_status(transfer.dmaDstAgent, transfer.dmaSrcAgent, &engineIdMask));
+  std::vector<int> engines;
+  for (int i = 0; i < 32; i++)
+    if (engineIdMask & (1U << i)) engines.push_back(i);
+
+  int firstEngine = nextEngine % std::max((int)engines.size(), 1);
+  if (transfer.exeSubIndex != -1)
+  {
+    auto it = std::find(engines.begin(), engines.end(), transfer.exeSubIndex);
+    if (it == engines.end())
+    {
+      InputError("Transfer %d: SDMA engine %d is not available (engine mask 0x%x)",
+                 transfer.transferIndex, transfer.exeSubIndex, engineIdMask);
+    }
+    firstEngine = it - engines.begin();
+  }
+  if (transfer.numSubExecs > engines.size())
+  {
+    InputError("Transfer %d: Unable to stripe across %d SDMA engines as only %lu are available (engine mask 0x%x)",
+               transfer.transferIndex, transfer.numSubExecs, engines.size(), engineIdMask);
+  }
+  nextEngine = firstEngine + transfer.numSubExecs;
+
+  // Each subExecutor is a stripe of the Transfer on its own engine
+  transfer.dmaEngineIds.resize(transfer.numSubExecs);
+  transfer.dmaSignals.resize(transfer.numSubExecs);
+  for (int i = 0; i < transfer.numSubExecs; i++)
+  {
+    transfer.dmaEngineIds[i] = 1U << engines[(firstEngine + i) % engines.size()];
+    HSA_CHECK(hsa_signal_create(1, 0, NULL, &transfer.dmaSignals[i]));
+  }
+#endif
+}
+
+void ReleaseHsaDmaTransfer(Transfer& transfer)
+{
+#if !defined(__NVCC__)
+  for (hsa_signal_t signal : transfer.dmaSignals)
+    HSA_CHECK(hsa_signal_destroy(signal));
+  transfer.dmaSignals.clear();
+  transfer.dmaEngineIds.clear();
+#endif
+}
+
+void RunHsaDmaTransfer(EnvVars const& ev, int const iteration, Transfer* transfer)
+{
+#if !defined(__NVCC__)
+  // Stripes are 4-byte aligned (tiny Transfers use fewer stripes), with the last stripe taking any remainder
+  int    const numStripes  = std::min(transfer->dmaSignals.size(), std::max(transfer->numBytesActual / 4, (size_t)1));
+  size_t const stripeBytes = transfer->numBytesActual / numStripes / 4 * 4;
+  char*        dst         = (char*)transfer->dstMem[0];
+  char*        src         = (char*)transfer->srcMem[0];
+
+  for (int i = 0; i < numStripes; i++)
+  {
+    size_t const offset   = i * stripeBytes;
+    size_t const numBytes = (i == numStripes - 1) ? transfer->numBytesActual - offset : stripeBytes;
+
+    hsa_signal_store_screlease(transfer->dmaSignals[i], 1);
+    HSA_CHECK(hsa_amd_memory_async_copy_on_engine(dst + offset, transfer->dmaDstAgent,
+                                                  src + offset, transfer->dmaSrcAgent,
+                                                  numBytes, 0, NULL, transfer->dmaSignals[i],
+                                                  (hsa_amd_sdma_engine_id_t)transfer->dmaEngineIds[i], true));
+  }
+
+  // Wait for all stripes to complete
+  uint64_t minStart = UINT64_MAX;
+  uint64_t maxEnd   = 0;
+  for (int i = 0; i < numStripes; i++)
+  {
+    while (hsa_signal_wait_scacquire(transfer->dmaSignals[i], HSA_SIGNAL_CONDITION_LT, 1,
+                                     UINT64_MAX, HSA_WAIT_STATE_ACTIVE) >= 1);
+    hsa_amd_profiling_async_copy_time_t copyTime;
+    HSA_CHECK(hsa_amd_profiling_get_async_copy_time(transfer->dmaSignals[i], &copyTime));
+    minStart = std::min(minStart, copyTime.start);
+    maxEnd   = std::max(maxEnd,   copyTime.end);
+  }
+
+  // Record the time from the first stripe starting to the last stripe finishing
+  if (iteration >= 0)
+  {
+    static uint64_t timestampFreq = 0;
+    if (timestampFreq == 0)
+      HSA_CHECK(hsa_system_get_info(HSA_SYSTEM_INFO_TIMESTAMP_FREQUENCY, &timestampFreq));
+
+    double const deltaMsec = (maxEnd - minStart) * 1000.0 / timestampFreq;
+    transfer->transferTime += deltaMsec;
+    transfer->latencyHistogram.Add(deltaMsec);
+    if (ev.showIterations)
+      transfer->perIterationTime.push_back(deltaMsec);
+  }
+#endif
+}
+
+void RunTransfer(EnvVars const& ev, int const iteration,
+                 ExecutorInfo& exeInfo, int const transferIdx, std::atomic<int>* numPending,
+                 std::chrono::high_resolution_clock::time_point* pendingDoneTime)
+{
+  Transfer* transfer = exeInfo.transfers[transferIdx];
+  int const numCompleted = (transfer->exeType == EXE_GPU_GFX && ev.useSingleStream) ? exeInfo.transfers.size() : 1;
+
+  if (!transfer->isLooping)
+  {
+    RunTransferPass(ev, iteration, exeInfo, transferIdx);
+    if (numPending && numPending->fetch_sub(numCompleted) == numCompleted)
+      *pendingDoneTime = std::chrono::high_resolution_clock::now();
+    return;
+  }
+
+  // Looping Transfers repeat until all Transfers have completed at least one pass, so that their links stay loaded
+  // for as long as any other Transfer is running.  Only the passes that completed while other Transfers were still
+  // running (or the first pass) count towards the iteration time, which is recorded as the mean time per pass
+  double             const prevTransferTime = transfer->transferTime;
+  LatencyHistogram   const prevHistogram    = transfer->latencyHistogram;
+  size_t             const prevNumIterTimes = transfer->perIterationTime.size();
+  size_t             const prevNumIterCUs   = transfer->perIterationCUs.size();
+  std::vector<double> passTimes;
+  for (int pass = 0; ; pass++)
+  {
+    double const timeBefore = transfer->transferTime;
+    RunTransferPass(ev, iteration, exeInfo, transferIdx);
+    int const stillPending = (pass == 0 ? numPending->fetch_sub(numCompleted) - numCompleted : numPending->load());
+    if (pass == 0 && stillPending == 0)
+      *pendingDoneTime = std::chrono::high_resolution_clock::now();
+    if (pass == 0 || stillPending > 0)
+      passTimes.push_back(transfer->transferTime - timeBefore);
+    if (stillPending <= 0) break;
+  }
+
+  if (iteration >= 0)
+  {
+    double passTimeSum = 0;
+    for (double passTime : passTimes)
+      passTimeSum += passTime;
+    double const meanPassTime = passTimeSum / passTimes.size();
+
+    transfer->transferTime     = prevTransferTime + meanPassTime;
+    transfer->latencyHistogram = prevHistogram;
+    for (double passTime : passTimes)
+      transfer->latencyHistogram.Add(passTime);
+    transfer->numLoopPasses   += passTimes.size();
+    if (ev.showIterations)
+    {
+      transfer->perIterationTime.resize(prevNumIterTimes);
+      transfer->perIterationTime.push_back(meanPassTime);
+      if (transfer->perIterationCUs.size() > prevNumIterCUs)
+        transfer->perIterationCUs.resize(prevNumIterCUs + 1);
+    }
+  }
+}
+
+void RunTransferPass(EnvVars const& ev, int const iteration,
+                     ExecutorInfo& exeInfo, int const transferIdx)
+{
+  Transfer* transfer = exeInfo.transfers[transferIdx];
+
+  if (transfer->exeType == EXE_GPU_GFX)
+  {
+    // Switch to executing GPU
+    int const exeIndex = RemappedIndex(transfer->exeIndex, false);
+    HIP_CALL(hipSetDevice(exeIndex));
+
+    hipEvent_t& startEvent = exeInfo.startEvents[transferIdx];
+    hipEvent_t& stopEvent  = exeInfo.stopEvents[transferIdx];
+
+    // Hardware counters of timed iterations are attributed to the Transfers executed by the kernel
+    // (in single-stream mode, split by each Transfer's share of the subExecutors via subExecIdx)
+    if (iteration >= 0 && GpuCountersEnabled())
+    {
+      CounterOwners owners;
+      if (ev.useSingleStream)
+      {
+        for (Transfer const* currTransfer : exeInfo.transfers)
+          owners.push_back(std::make_pair(currTransfer, currTransfer->subExecIdx.size() / (double)exeInfo.totalSubExecs));
+      }
+      else
+        owners.push_back(std::make_pair(transfer, 1.0));
+      GpuCountersBeginLaunch(owners);
+    }
+    LaunchGpuTransfer(ev, exeInfo, transferIdx, 0, startEvent, stopEvent);
+    GpuCountersEndLaunch();
+
+    // Synchronize per iteration
+    HIP_CALL(hipStreamSynchronize(exeInfo.streams[transferIdx]));
+
+    if (iteration >= 0)
+      RecordGfxTiming(ev, exeInfo, transferIdx, 0, startEvent, stopEvent);
+  }
+  else if (transfer->exeType == EXE_GPU_DMA)
+  {
+    // Switch to executing GPU
+    int const exeIndex = RemappedIndex(transfer->exeIndex, false);
+    HIP_CALL(hipSetDevice(exeIndex));
+
+    // Memset Transfers have no HSA equivalent and are always issued through HIP
+    if (ev.useHsaDma && transfer->numSrcs == 1)
+    {
+      RunHsaDmaTransfer(ev, iteration, transfer);
+      return;
+    }
+
+    hipEvent_t& startEvent = exeInfo.startEvents[transferIdx];
+    hipEvent_t& stopEvent  = exeInfo.stopEvents[transferIdx];
+
+    LaunchGpuTransfer(ev, exeInfo, transferIdx, 0, startEvent, stopEvent);
+    HIP_CALL(hipStreamSynchronize(exeInfo.streams[transferIdx]));
+
+    if (iteration >= 0)
+      RecordDmaTiming(ev, exeInfo, transferIdx, startEvent, stopEvent);
+  }
+  else if (transfer->exeType == EXE_CPU) // CPU execution agent
+  {
+    int const exeIndex = RemappedIndex(transfer->exeIndex, true);
+    std::chrono::high_resolution_clock::duration cpuDelta;
+
+    // Non-fp32 datatypes use scalar typed CPU kernels
+    CpuKernelFuncPtr const cpuKernel = (ev.dataType == DATA_FP32 ? CpuKernelTable[ev.cpuKernel]
+                                                                 : CpuTypedKernelTable[ev.dataType][ev.nativeAccum]);
+
+    if (ev.useCpuThreadPool)
+    {
+      // Hand each subExecutor to a persistent, core-pinned worker thread on the correct NUMA node
+      CpuThreadPool& threadPool = GetCpuThreadPool(ev, exeIndex);
+
+      auto cpuStart = std::chrono::high_resolution_clock::now();
+      threadPool.Execute(transfer->subExecOffset, transfer->subExecParam, cpuKernel);
+      cpuDelta = std::chrono::high_resolution_clock::now() - cpuStart;
+    }
+    else
+    {
+      // Force this thread and all child threads onto correct NUMA node
+      if (numa_run_on_node(exeIndex))
+      {
+        RunError("Unable to set CPU to NUMA node %d", exeIndex);
+      }
+
+      std::vector<std::thread> childThreads;
+
+      auto cpuStart = std::chrono::high_resolution_clock::now();
+
+      // Launch each subExecutor in child-threads to perform memcopies
+      for (int i = 0; i < transfer->numSubExecs; ++i)
+        childThreads.push_back(std::thread(cpuKernel, std::ref(transfer->subExecParam[i])));
+
+      // Wait for child-threads to finish
+      for (int i = 0; i < transfer->numSubExecs; ++i)
+        childThreads[i].join();
+
+      cpuDelta = std::chrono::high_resolution_clock::now() - cpuStart;
+    }
+
+    // Record time if not a warmup iteration
+    if (iteration >= 0)
+    {
+      double const delta = (std::chrono::duration_cast<std::chrono::duration<double>>(cpuDelta).count() * 1000.0);
+      transfer->transferTime += delta;
+      transfer->latencyHistogram.Add(delta);
+      if (ev.showIterations)
+        transfer->perIterationTime.push_back(delta);
+    }
+  }
+}
+
+void RunTransferAsync(EnvVars const& ev, int const firstIteration, int const numIterations,
+                      ExecutorInfo& exeInfo, int const transferIdx)
+{
+  Transfer* transfer = exeInfo.transfers[transferIdx];
+
+  // CPU executors have no launch queue, so iterations are simply performed back-to-back
+  if (transfer->exeType == EXE_CPU)
+  {
+    for (int i = 0; i < numIterations; i++)
+      RunTransfer(ev, firstIteration + i, exeInfo, transferIdx);
+    return;
+  }
+
+  // Switch to executing GPU
+  int const exeIndex = RemappedIndex(transfer->exeIndex, false);
+  HIP_CALL(hipSetDevice(exeIndex));
+
+  // Each iteration of a batch is bracketed by its own pair of events, and writes to its own parameter slice
+  // (the events of each slice were acquired along with the stream, see AcquireStreams)
+  int const batchSize = std::min(numIterations, NumParamSlices(ev));
+  hipEvent_t* startEvents = &exeInfo.startEvents[transferIdx * NumParamSlices(ev)];
+  hipEvent_t* stopEvents  = &exeInfo.stopEvents[transferIdx * NumParamSlices(ev)];
+
+  // Enqueue each batch of iterations without any host synchronization in between, then collect its timing
+  // (slices are only re-used once the timestamps of the previous batch have been read back)
+  for (int batchStart = 0; batchStart < numIterations; batchStart += batchSize)
+  {
+    int const numInBatch = std::min(batchSize, numIterations - batchStart);
+    for (int slice = 0; slice < numInBatch; slice++)
+      LaunchGpuTransfer(ev, exeInfo, transferIdx, slice, startEvents[slice], stopEvents[slice]);
+    HIP_CALL(hipStreamSynchronize(exeInfo.streams[transferIdx]));
+
+    for (int slice = 0; slice < numInBatch; slice++)
+    {
+      if (firstIteration + batchStart + slice < 0) continue;
+      if (transfer->exeType == EXE_GPU_GFX)
+        RecordGfxTiming(ev, exeInfo, transferIdx, slice, startEvents[slice], stopEvents[slice]);
+      else
+        RecordDmaTiming(ev, exeInfo, transferIdx, startEvents[slice], stopEvents[slice]);
+    }
+  }
+}
+
+void RunPeerToPeerBenchmarks(EnvVars const& ev, size_t N)
+{
+  ev.DisplayP2PBenchmarkEnvVars();
+
+  char const separator = ev.outputToCsv ? ',' : ' ';
+  printf("Bytes Per Direction%c%lu\n", separator, N * sizeof(float));
+
+  // Collect the number of available CPUs/GPUs on this machine
+  int const numCpus    = ev.numCpuDevices;
+  int const numGpus    = ev.numGpuDevices;
+  int const numDevices = numCpus + numGpus;
+
+  // Enable peer to peer for each GPU
+  for (int i = 0; i < numGpus; i++)
+    for (int j = 0; j < numGpus; j++)
+      if (i != j) EnablePeerAccess(i, j);
+
+  // Perform unidirectional / bidirectional
+  for (int isBidirectional = 0; isBidirectional <= 1; isBidirectional++)
+  {
+    if (ev.p2pMode == 1 && isBidirectional == 1 ||
+        ev.p2pMode == 2 && isBidirectional == 0) continue;
+
+    printf("%sdirectional copy peak bandwidth GB/s [%s read / %s write] (GPU-Executor: %s)\n", isBidirectional ? "Bi" : "Uni",
+           ev.useRemoteRead ? "Remote" : "Local",
+           ev.useRemoteRead ? "Local" : "Remote",
+           ev.useDmaCopy    ? "DMA"   : "GFX");
+
+    // Print header
+    if (isBidirectional)
+    {
+      printf("%12s", "SRC\\DST");
+    }
+    else
+    {
+      if (ev.useRemoteRead)
+        printf("%12s", "SRC\\EXE+DST");
+      else
+        printf("%12s", "SRC+EXE\\DST");
+    }
+    if (ev.outputToCsv) printf(",");
+    for (int i = 0; i < numCpus; i++)
+    {
+      printf("%7s %02d", "CPU", i);
+      if (ev.outputToCsv) printf(",");
+    }
+    if (numCpus > 0) printf("   ");
+    for (int i = 0; i < numGpus; i++)
+    {
+      printf("%7s %02d", "GPU", i);
+      if (ev.outputToCsv) printf(",");
+    }
+    printf("\n");
+
+    double avgBwSum[2][2] = {};
+    int    avgCount[2][2] = {};
+
+    ExeType const gpuExeType = ev.useDmaCopy ? EXE_GPU_DMA : EXE_GPU_GFX;
+    // Loop over all possible src/dst pairs
+    for (int src = 0; src < numDevices; src++)
+    {
+      MemType const srcType  = (src < numCpus ? MEM_CPU : MEM_GPU);
+      int     const srcIndex = (srcType == MEM_CPU ? src : src - numCpus);
+      MemType const srcTypeActual = ((ev.useFineGrain && srcType == MEM_CPU) ? MEM_CPU_FINE :
+                                     (ev.useFineGrain && srcType == MEM_GPU) ? MEM_GPU_FINE :
+                                                                               srcType);
+      std::vector<std::vector<double>> avgBandwidth(isBidirectional + 1);
+      std::vector<std::vector<double>> minBandwidth(isBidirectional + 1);
+      std::vector<std::vector<double>> maxBandwidth(isBidirectional + 1);
+      std::vector<std::vector<double>> stdDev(isBidirectional + 1);
+
+      if (src == numCpus && src != 0) printf("\n");
+      for (int dst = 0; dst < numDevices; dst++)
+      {
+        MemType const dstType  = (dst < numCpus ? MEM_CPU : MEM_GPU);
+        int     const dstIndex = (dstType == MEM_CPU ? dst : dst - numCpus);
+        MemType const dstTypeActual = ((ev.useFineGrain && dstType == MEM_CPU) ? MEM_CPU_FINE :
+                                       (ev.useFineGrain && dstType == MEM_GPU) ? MEM_GPU_FINE :
+                                                                                 dstType);
+        // Prepare Transfers
+        std::vector<Transfer> transfers(isBidirectional + 1);
+
+        // SRC -> DST
+        transfers[0].numBytes = N * sizeof(float);
+        transfers[0].srcType.push_back(srcTypeActual);
+        transfers[0].dstType.push_back(dstTypeActual);
+        transfers[0].srcIndex.push_back(srcIndex);
+        transfers[0].dstIndex.push_back(dstIndex);
+        transfers[0].numSrcs = transfers[0].numDsts = 1;
+        transfers[0].exeType = IsGpuType(ev.useRemoteRead ? dstType : srcType) ? gpuExeType : EXE_CPU;
+        transfers[0].exeIndex = (ev.useRemoteRead ? dstIndex : srcIndex);
+        transfers[0].numSubExecs = IsGpuType(transfers[0].exeType) ? ev.numGpuSubExecs : ev.numCpuSubExecs;
+
+        // DST -> SRC
+        if (isBidirectional)
         {
-          ExecuteTransfers(ev, 0, N, transfers, false);
+          transfers[1].numBytes = N * sizeof(float);
+          transfers[1].numSrcs = transfers[1].numDsts = 1;
+          transfers[1].srcType.push_back(dstTypeActual);
+          transfers[1].dstType.push_back(srcTypeActual);
+          transfers[1].srcIndex.push_back(dstIndex);
+          transfers[1].dstIndex.push_back(srcIndex);
+          transfers[1].exeType = IsGpuType(ev.useRemoteRead ? srcType : dstType) ? gpuExeType : EXE_CPU;
+          transfers[1].exeIndex = (ev.useRemoteRead ? srcIndex : dstIndex);
+          transfers[1].numSubExecs = IsGpuType(transfers[1].exeType) ? ev.numGpuSubExecs : ev.numCpuSubExecs;
+        }
+
+        bool skipTest = false;
+
+        // Abort if executing on NUMA node with no CPUs
+        for (int i = 0; i <= isBidirectional; i++)
+        {
+          if (transfers[i].exeType == EXE_CPU && ev.numCpusPerNuma[transfers[i].exeIndex] == 0)
+          {
+            skipTest = true;
+            break;
+          }
+
+#if defined(__NVCC__)
+          // NVIDIA platform cannot access GPU memory directly from CPU executors
+          if (transfers[i].exeType == EXE_CPU && (IsGpuType(srcType) || IsGpuType(dstType)))
+          {
+            skipTest = true;
+            break;
+          }
+#endif
+        }
+
+        if (isBidirectional && srcType == dstType && srcIndex == dstIndex) skipTest = true;
+
+        if (!skipTest)
+        {
+          ExecuteTransfers(ev, 0, N, transfers, false);
+
+          for (int dir = 0; dir <= isBidirectional; dir++)
+          {
+            double const avgTime = transfers[dir].transferTime / transfers[dir].numTimedIterations;
+            double const avgBw   = (transfers[dir].numBytesActual / 1.0E9) / avgTime * 1000.0f;
+            avgBandwidth[dir].push_back(avgBw);
+
+            JsonObject record;
+            record.Add("mode", isBidirectional ? "bidirectional" : "unidirectional")
+              .Add("src", transfers[dir].SrcToStr()).Add("dst", transfers[dir].DstToStr())
+              .Add("exe", std::string(1, ExeTypeStr[transfers[dir].exeType]) + std::to_string(transfers[dir].exeIndex))
+              .Add("numSubExecs", transfers[dir].numSubExecs).Add("bandwidthGbs", avgBw);
+            ResultsSink::Get().Write("p2p", record);
+
+            if (!(srcType == dstType && srcIndex == dstIndex))
+            {
+              avgBwSum[srcType][dstType] += avgBw;
+              avgCount[srcType][dstType]++;
+            }
+
+            if (ev.showIterations)
+            {
+              double minTime = transfers[dir].perIterationTime[0];
+              double maxTime = transfers[dir].perIterationTime[0];
+              double varSum  = 0;
+              for (int i = 0; i < transfers[dir].perIterationTime.size(); i++)
+              {
+                minTime = std::min(minTime, transfers[dir].perIterationTime[i]);
+                maxTime = std::max(maxTime, transfers[dir].perIterationTime[i]);
+                double const bw  = (transfers[dir].numBytesActual / 1.0E9) / transfers[dir].perIterationTime[i] * 1000.0f;
+                double const delta = (avgBw - bw);
+                varSum += delta * delta;
+              }
+              double const minBw = (transfers[dir].numBytesActual / 1.0E9) / maxTime * 1000.0f;
+              double const maxBw = (transfers[dir].numBytesActual / 1.0E9) / minTime * 1000.0f;
+              double const stdev = sqrt(varSum / transfers[dir].perIterationTime.size());
+              minBandwidth[dir].push_back(minBw);
+              maxBandwidth[dir].push_back(maxBw);
+              stdDev[dir].push_back(stdev);
+            }
+          }
+        }
+        else
+        {
+          for (int dir = 0; dir <= isBidirectional; dir++)
+          {
+            avgBandwidth[dir].push_back(0);
+            minBandwidth[dir].push_back(0);
+            maxBandwidth[dir].push_back(0);
+            stdDev[dir].push_back(-1.0);
+          }
+        }
+      }
+
+      for (int dir = 0; dir <= isBidirectional; dir++)
+      {
+        printf("%5s %02d %3s", (srcType == MEM_CPU) ? "CPU" : "GPU", srcIndex, dir ? "<- " : " ->");
+        if (ev.outputToCsv) printf(",");
+
+        for (int dst = 0; dst < numDevices; dst++)
+        {
+          if (dst == numCpus && dst != 0) printf("   ");
+          double const avgBw = avgBandwidth[dir][dst];
+
+          if (avgBw == 0.0)
+            printf("%10s", "N/A");
+          else
+            printf("%10.2f", avgBw);
+          if (ev.outputToCsv) printf(",");
+        }
+        printf("\n");
+
+        if (ev.showIterations)
+        {
+          // minBw
+          printf("%5s %02d %3s", (srcType == MEM_CPU) ? "CPU" : "GPU", srcIndex, "min");
+          if (ev.outputToCsv) printf(",");
+          for (int i = 0; i < numDevices; i++)
+          {
+            double const minBw = minBandwidth[dir][i];
+            if (i == numCpus && i != 0) printf("   ");
+            if (minBw == 0.0)
+              printf("%10s", "N/A");
+            else
+              printf("%10.2f", minBw);
+            if (ev.outputToCsv) printf(",");
+          }
+          printf("\n");
+
+          // maxBw
+          printf("%5s %02d %3s", (srcType == MEM_CPU) ? "CPU" : "GPU", srcIndex, "max");
+          if (ev.outputToCsv) printf(",");
+          for (int i = 0; i < numDevices; i++)
+          {
+            double const maxBw = maxBandwidth[dir][i];
+            if (i == numCpus && i != 0) printf("   ");
+            if (maxBw == 0.0)
+              printf("%10s", "N/A");
+            else
+              printf("%10.2f", maxBw);
+            if (ev.outputToCsv) printf(",");
+          }
+          printf("\n");
+
+          // stddev
+          printf("%5s %02d %3s", (srcType == MEM_CPU) ? "CPU" : "GPU", srcIndex, " sd");
+          if (ev.outputToCsv) printf(",");
+          for (int i = 0; i < numDevices; i++)
+          {
+            double const sd = stdDev[dir][i];
+            if (i == numCpus && i != 0) printf("   ");
+            if (sd == -1.0)
+              printf("%10s", "N/A");
+            else
+              printf("%10.2f", sd);
+            if (ev.outputToCsv) printf(",");
+          }
+          printf("\n");
+        }
+        fflush(stdout);
+      }
+
+      if (isBidirectional)
+      {
+        printf("%5s %02d %3s", (srcType == MEM_CPU) ? "CPU" : "GPU", srcIndex, "<->");
+        if (ev.outputToCsv) printf(",");
+        for (int dst = 0; dst < numDevices; dst++)
+        {
+          double const sumBw = avgBandwidth[0][dst] + avgBandwidth[1][dst];
+          if (dst == numCpus && dst != 0) printf("   ");
+          if (sumBw == 0.0)
+            printf("%10s", "N/A");
+          else
+            printf("%10.2f", sumBw);
+          if (ev.outputToCsv) printf(",");
+        }
+        printf("\n");
+        if (src < numDevices - 1) printf("\n");
+      }
+    }
+
+    if (!ev.outputToCsv)
+    {
+      printf("                         ");
+      for (int srcType : {MEM_CPU, MEM_GPU})
+        for (int dstType : {MEM_CPU, MEM_GPU})
+          printf("  %cPU->%cPU", srcType == MEM_CPU ? 'C' : 'G', dstType == MEM_CPU ? 'C' : 'G');
+      printf("\n");
+
+      printf("Averages (During %s):",  isBidirectional ? " BiDir" : "UniDir");
+      for (int srcType : {MEM_CPU, MEM_GPU})
+        for (int dstType : {MEM_CPU, MEM_GPU})
+        {
+          if (avgCount[srcType][dstType])
+            printf("%10.2f", avgBwSum[srcType][dstType] / avgCount[srcType][dstType]);
+          else
+            printf("%10s", "N/A");
+        }
+      printf("\n\n");
+    }
+  }
+}
+
+void RunScalingBenchmark(EnvVars const& ev, size_t N, int const exeIndex, int const maxSubExecs)
+{
+  ev.DisplayEnvVars();
+
+  // Collect the number of available CPUs/GPUs on this machine
+  int const numCpus    = ev.numCpuDevices;
+  int const numGpus    = ev.numGpuDevices;
+  int const numDevices = numCpus + numGpus;
+
+  // Enable peer to peer for each GPU
+  for (int i = 0; i < numGpus; i++)
+    for (int j = 0; j < numGpus; j++)
+      if (i != j) EnablePeerAccess(i, j);
+
+  char separator = (ev.outputToCsv ? ',' : ' ');
+
+  std::vector<Transfer> transfers(1);
+  transfers[0].numBytes = N * sizeof(float);
+  transfers[0].numSrcs  = 1;
+  transfers[0].numDsts  = 1;
+  transfers[0].exeType  = EXE_GPU_GFX;
+  transfers[0].exeIndex = exeIndex;
+  transfers[0].srcType.resize(1, MEM_GPU);
+  transfers[0].dstType.resize(1, MEM_GPU);
+  transfers[0].srcIndex.resize(1);
+  transfers[0].dstIndex.resize(1);
+
+  printf("GPU-GFX Scaling benchmark:\n");
+  printf("==========================\n");
+  printf("- Copying %lu bytes from GPU %d to other devices\n", transfers[0].numBytes, exeIndex);
+  printf("- All numbers reported as GB/sec\n\n");
+
+  printf("NumCUs");
+  for (int i = 0; i < numDevices; i++)
+    printf("%c  %s%02d     ", separator, i < numCpus ? "CPU" : "GPU", i < numCpus ? i : i - numCpus);
+  printf("\n");
+
+  std::vector<std::pair<double, int>> bestResult(numDevices);
+  for (int numSubExec = 1; numSubExec <= maxSubExecs; numSubExec++)
+  {
+    transfers[0].numSubExecs = numSubExec;
+    printf("%4d  ", numSubExec);
+
+    for (int i = 0; i < numDevices; i++)
+    {
+      transfers[0].dstType[0]  = i < numCpus ? MEM_CPU : MEM_GPU;
+      transfers[0].dstIndex[0] = i < numCpus ? i : i - numCpus;
+
+      ExecuteTransfers(ev, 0, N, transfers, false);
+      double transferDurationMsec = transfers[0].transferTime / (1.0 * transfers[0].numTimedIterations);
+      double transferBandwidthGbs = (transfers[0].numBytesActual / 1.0E9) / transferDurationMsec * 1000.0f;
+      printf("%c%7.2f     ", separator, transferBandwidthGbs);
+
+      JsonObject record;
+      record.Add("exe", "G" + std::to_string(exeIndex)).Add("dst", transfers[0].DstToStr())
+        .Add("numSubExecs", numSubExec).Add("bandwidthGbs", transferBandwidthGbs);
+      ResultsSink::Get().Write("scaling", record);
+
+      if (transferBandwidthGbs > bestResult[i].first)
+      {
+        bestResult[i].first  = transferBandwidthGbs;
+        bestResult[i].second = numSubExec;
+      }
+    }
+    printf("\n");
+  }
+
+  printf(" Best ");
+  for (int i = 0; i < numDevices; i++)
+  {
+    printf("%c%7.2f(%3d)", separator, bestResult[i].first, bestResult[i].second);
+  }
+  printf("\n");
+}
+
+void RunAllToAllBenchmark(EnvVars const& ev, size_t const numBytesPerTransfer, int const numSubExecs)
+{
+  ev.DisplayA2AEnvVars();
+
+  // Collect the number of GPU devices to use
+  int const numGpus = ev.numGpuDevices;
+
+  // Enable peer to peer for each GPU
+  for (int i = 0; i < numGpus; i++)
+    for (int j = 0; j < numGpus; j++)
+      if (i != j) EnablePeerAccess(i, j);
+
+  char separator = (ev.outputToCsv ? ',' : ' ');
+
+  Transfer transfer;
+  transfer.numBytes    = numBytesPerTransfer;
+  transfer.numSubExecs = numSubExecs;
+  transfer.numSrcs     = 1;
+  transfer.numDsts     = 1;
+  transfer.exeType     = EXE_GPU_GFX;
+  transfer.srcType.resize(1, ev.useFineGrain ? MEM_GPU_FINE : MEM_GPU);
+  transfer.dstType.resize(1, ev.useFineGrain ? MEM_GPU_FINE : MEM_GPU);
+  transfer.srcIndex.resize(1);
+  transfer.dstIndex.resize(1);
+
+  std::vector<Transfer> transfers;
+  for (int i = 0; i < numGpus; i++)
+  {
+    transfer.srcIndex[0] = i;
+    for (int j = 0; j < numGpus; j++)
+    {
+      transfer.dstIndex[0] = j;
+      transfer.exeIndex    = (ev.useRemoteRead ? j : i);
+
+      if (ev.a2aDirect)
+      {
+#if !defined(__NVCC__)
+        if (i == j) continue;
+
+        uint32_t linkType, hopCount;
+        HIP_CALL(hipExtGetLinkTypeAndHopCount(RemappedIndex(i, false),
+                                              RemappedIndex(j, false),
+                                              &linkType, &hopCount));
+        if (hopCount != 1) continue;
+#endif
+      }
+      transfers.push_back(transfer);
+    }
+  }
+
+  printf("GPU-GFX All-To-All benchmark:\n");
+  printf("==========================\n");
+  printf("- Copying %lu bytes between %s pairs of GPUs using %d CUs (%lu Transfers)\n",
+         numBytesPerTransfer, ev.a2aDirect ? "directly connected" : "all", numSubExecs, transfers.size());
+  if (transfers.size() == 0) return;
+
+  double totalBandwidthCpu = 0;
+  ExecuteTransfers(ev, 0, numBytesPerTransfer / sizeof(float), transfers, true, &totalBandwidthCpu);
+
+  printf("\nSummary:\n");
+  printf("==========================================================\n");
+  printf("SRC\\DST");
+  for (int dst = 0; dst < numGpus; dst++)
+    printf("%cGPU %02d   ", separator, dst);
+  printf("   %cSTotal\n", separator);
+
+  std::map<std::pair<int, int>, int> reIndex;
+  for (int i = 0; i < transfers.size(); i++)
+  {
+    Transfer const& t = transfers[i];
+    reIndex[std::make_pair(t.srcIndex[0], t.dstIndex[0])] = i;
+  }
+
+  double totalBandwidthGpu = 0.0;
+  std::vector<double> colTotalBandwidth(numGpus+1, 0.0);
+  for (int src = 0; src < numGpus; src++)
+  {
+    double rowTotalBandwidth = 0;
+    printf("GPU %02d", src);
+    for (int dst = 0; dst < numGpus; dst++)
+    {
+      if (reIndex.count(std::make_pair(src, dst)))
+      {
+        Transfer const& transfer = transfers[reIndex[std::make_pair(src,dst)]];
+        double transferDurationMsec = transfer.transferTime / (1.0 * transfer.numTimedIterations);
+        double transferBandwidthGbs = (transfer.numBytesActual / 1.0E9) / transferDurationMsec * 1000.0f;
+        colTotalBandwidth[dst] += transferBandwidthGbs;
+        rowTotalBandwidth += transferBandwidthGbs;
+        totalBandwidthGpu += transferBandwidthGbs;
+        printf("%c%7.2f  ", separator, transferBandwidthGbs);
+      }
+      else
+      {
+        printf("%c%7s  ", separator, "N/A");
+      }
+    }
+    printf("   %c%7.2f\n", separator, rowTotalBandwidth);
+    colTotalBandwidth[numGpus] += rowTotalBandwidth;
+  }
+  printf("\nRTotal");
+  for (int dst = 0; dst < numGpus; dst++)
+  {
+    printf("%c%7.2f  ", separator, colTotalBandwidth[dst]);
+  }
+  printf("   %c%7.2f\n", separator, colTotalBandwidth[numGpus]);
+  printf("\n");
+
+  printf("Average   bandwidth (GPU Timed): %7.2f GB/s\n", totalBandwidthGpu / transfers.size());
+  printf("Aggregate bandwidth (GPU Timed): %7.2f GB/s\n", totalBandwidthGpu);
+  printf("Aggregate bandwidth (CPU Timed): %7.2f GB/s\n", totalBandwidthCpu);
+
+  JsonObject record;
+  record.Add("numTransfers", transfers.size()).Add("numBytes", numBytesPerTransfer).Add("numSubExecs", numSubExecs)
+    .Add("avgBandwidthGbs", totalBandwidthGpu / transfers.size())
+    .Add("gpuBandwidthGbs", totalBandwidthGpu).Add("cpuBandwidthGbs", totalBandwidthCpu);
+  ResultsSink::Get().Write("a2a", record);
+}
+
+void RunCollectiveBenchmark(EnvVars const& ev, size_t const numBytes, int const numSubExecs, CollType const collType)
+{
+  ev.DisplayCollEnvVars();
+
+  std::vector<int> const& ring = ev.collRingOrder;
+  int const numGpus = ring.size();
+  if (numGpus < 2)
+  {
+    printf("[ERROR] Collective benchmarks require at least 2 GPUs\n");
+    exit(1);
+  }
+
+  // Enable peer to peer between GPUs in the ring
+  for (int i : ring)
+    for (int j : ring)
+      if (i != j) EnablePeerAccess(i, j);
+
+  char separator = (ev.outputToCsv ? ',' : ' ');
+
+  // Ring collectives move 1/numGpus of the data per step, broadcasts forward all of it down the tree.
+  // Each step's data may be further split into chunks that are pipelined as separate steps
+  size_t const pieceBytes = (collType == COLL_BROADCAST ? numBytes : numBytes / numGpus) / 4 * 4;
+  size_t const chunkBytes = ev.collChunkBytes ? std::min((size_t)ev.collChunkBytes, pieceBytes) : pieceBytes;
+  if (chunkBytes == 0)
+  {
+    printf("[ERROR] Collective size of %lu bytes is too small for %d GPUs\n", numBytes, numGpus);
+    exit(1);
+  }
+  size_t const numChunks = (pieceBytes + chunkBytes - 1) / chunkBytes;
+
+  MemType const memType = (ev.useFineGrain ? MEM_GPU_FINE : MEM_GPU);
+  auto makeTransfer = [&](std::vector<int> const& srcs, int const exeIndex, std::vector<int> const& dsts)
+  {
+    Transfer transfer;
+    transfer.numBytes    = chunkBytes;
+    transfer.numSubExecs = numSubExecs;
+    transfer.exeType     = EXE_GPU_GFX;
+    transfer.exeIndex    = exeIndex;
+    transfer.numSrcs     = srcs.size();
+    transfer.srcType.assign(srcs.size(), memType);
+    transfer.srcIndex    = srcs;
+    transfer.numDsts     = dsts.size();
+    transfer.dstType.assign(dsts.size(), memType);
+    transfer.dstIndex    = dsts;
+    return transfer;
+  };
+
+  // Each phase is a set of Transfers that all run in parallel during one step, repeated numSteps times
+  struct CollPhase
+  {
+    std::string           name;
+    std::vector<Transfer> transfers;
+    size_t                numSteps;
+  };
+  std::vector<CollPhase> phases;
+
+  if (collType == COLL_ALLREDUCE || collType == COLL_REDUCESCATTER)
+  {
+    // Each GPU reduces the chunk received from the previous GPU in the ring with its own chunk
+    CollPhase phase = {"Reduce-scatter step", {}, (numGpus - 1) * numChunks};
+    for (int i = 0; i < numGpus; i++)
+    {
+      int const prev = ring[(i + numGpus - 1) % numGpus];
+      int const curr = ring[i];
+      phase.transfers.push_back(makeTransfer({prev, curr}, ev.useRemoteRead ? curr : prev, {curr}));
+    }
+    phases.push_back(phase);
+  }
+  if (collType == COLL_ALLREDUCE || collType == COLL_ALLGATHER)
+  {
+    // Each GPU forwards a chunk to the next GPU in the ring
+    CollPhase phase = {"All-gather step", {}, (numGpus - 1) * numChunks};
+    for (int i = 0; i < numGpus; i++)
+    {
+      int const prev = ring[(i + numGpus - 1) % numGpus];
+      int const curr = ring[i];
+      phase.transfers.push_back(makeTransfer({prev}, ev.useRemoteRead ? curr : prev, {curr}));
+    }
+    phases.push_back(phase);
+  }
+  if (collType == COLL_BROADCAST)
+  {
+    // Binary tree over the ring order (node i has children 2i+1 and 2i+2). Once the pipeline is
+    // full, every level of the tree forwards a chunk at the same time
+    int depth = 0;
+    while ((2 << depth) <= numGpus) depth++;
+
+    CollPhase phase = {"Broadcast step", {}, numChunks + depth - 1};
+    for (int i = 0; i < numGpus; i++)
+    {
+      std::vector<int> children;
+      for (int c = 2 * i + 1; c <= 2 * i + 2 && c < numGpus; c++)
+        children.push_back(ring[c]);
+      if (children.empty()) continue;
+
+      if (ev.useRemoteRead)
+      {
+        for (int child : children)
+          phase.transfers.push_back(makeTransfer({ring[i]}, child, {child}));
+      }
+      else
+        phase.transfers.push_back(makeTransfer({ring[i]}, ring[i], children));
+    }
+    phases.push_back(phase);
+  }
+
+  printf("GPU-GFX %s benchmark:\n", CollTypeName[collType]);
+  printf("==========================\n");
+  printf("- %lu bytes across %d GPUs using %d CUs per Transfer (%lu chunk(s) of %lu bytes per step)\n",
+         numBytes, numGpus, numSubExecs, numChunks, chunkBytes);
+
+  // Time one step of each phase.  A step completes once its slowest Transfer completes.  Steps depend on
+  // data from the previous step on another GPU, so the collective time is estimated from the per-step time
+  double totalTimeMsec = 0;
+  size_t totalSteps    = 0;
+  int    testNum       = 0;
+  for (CollPhase& phase : phases)
+  {
+    if (!ev.outputToCsv) printf("\n%s (x%lu):\n", phase.name.c_str(), phase.numSteps);
+    ExecuteTransfers(ev, ++testNum, chunkBytes / sizeof(float), phase.transfers, true);
+
+    double stepTimeMsec = 0;
+    for (Transfer const& transfer : phase.transfers)
+      stepTimeMsec = std::max(stepTimeMsec, transfer.transferTime / (1.0 * transfer.numTimedIterations));
+    totalTimeMsec += stepTimeMsec * phase.numSteps;
+    totalSteps    += phase.numSteps;
+  }
+
+  // Bus bandwidth follows the same convention as rccl-tests
+  double busFactor = 1.0;
+  switch (collType)
+  {
+  case COLL_ALLREDUCE:     busFactor = 2.0 * (numGpus - 1) / numGpus; break;
+  case COLL_REDUCESCATTER: busFactor = 1.0 * (numGpus - 1) / numGpus; break;
+  case COLL_ALLGATHER:     busFactor = 1.0 * (numGpus - 1) / numGpus; break;
+  default:                 busFactor = 1.0;                           break;
+  }
+  double const algBandwidthGbs = (numBytes / 1.0E9) / totalTimeMsec * 1000.0;
+  double const busBandwidthGbs = algBandwidthGbs * busFactor;
+
+  printf("\nSummary (estimated as slowest Transfer per step x number of steps):\n");
+  printf("==========================================================\n");
+  printf("%-13s%c%5s%c%12s%c%12s%c%6s%c%11s%c%12s%c%12s\n",
+         "Collective", separator, "#GPUs", separator, "Bytes", separator, "ChunkBytes", separator,
+         "Steps", separator, "EstTime(ms)", separator, "AlgBW(GB/s)", separator, "BusBW(GB/s)");
+  printf("%-13s%c%5d%c%12lu%c%12lu%c%6lu%c%11.3f%c%12.2f%c%12.2f\n",
+         CollTypeName[collType], separator, numGpus, separator, numBytes, separator, chunkBytes, separator,
+         totalSteps, separator, totalTimeMsec, separator, algBandwidthGbs, separator, busBandwidthGbs);
+
+  JsonObject record;
+  record.Add("collective", CollTypeName[collType]).Add("numGpus", numGpus).Add("numBytes", numBytes)
+    .Add("chunkBytes", chunkBytes).Add("numSteps", totalSteps).Add("timeMs", totalTimeMsec).Add("estimated", true)
+    .Add("algBandwidthGbs", algBandwidthGbs).Add("busBandwidthGbs", busBandwidthGbs);
+  ResultsSink::Get().Write("collective", record);
+}
+
+void RunPipelineBenchmark(EnvVars const& ev, size_t const numBytes)
+{
+  ev.DisplayPipelineEnvVars();
+
+  // Parse the memory locations that each chunk is forwarded through
+  std::vector<MemType> memTypes;
+  std::vector<int>     memIndices, memRanks;
+  std::string pathStr = ev.pipelinePath;
+  std::replace(pathStr.begin(), pathStr.end(), ',', ' ');
+  ParseMemType(pathStr, ev.numCpuDevices, ev.numGpuDevices, memTypes, memIndices, memRanks);
+
+  int const numLocs = memTypes.size();
+  int const numHops = numLocs - 1;
+  if (numHops < 1)
+  {
+    printf("[ERROR] PIPELINE_PATH must contain at least two memory locations\n");
+    exit(1);
+  }
+
+  if (numBytes == 0)
+  {
+    printf("[ERROR] Pipeline benchmark requires a non-zero number of bytes\n");
+    exit(1);
+  }
+
+  char separator = (ev.outputToCsv ? ',' : ' ');
+
+  size_t const chunkBytes = std::min((size_t)ev.pipelineChunkBytes, numBytes);
+  size_t const numChunks  = (numBytes + chunkBytes - 1) / chunkBytes;
+  int    const depth      = std::min((size_t)ev.pipelineDepth, numChunks);
+
+  // Each hop is executed by the DMA engine of the GPU on either side of it (preferring the source)
+  std::vector<int> hopDevice(numHops);
+  for (int h = 0; h < numHops; h++)
+  {
+    if (IsGpuType(memTypes[h]))
+      hopDevice[h] = memIndices[h];
+    else if (IsGpuType(memTypes[h+1]))
+      hopDevice[h] = memIndices[h+1];
+    else
+    {
+      printf("[ERROR] Pipeline hop %d (%c%d -> %c%d) requires at least one GPU memory location\n", h,
+             MemTypeStr[memTypes[h]], memIndices[h], MemTypeStr[memTypes[h+1]], memIndices[h+1]);
+      exit(1);
+    }
+    if (IsGpuType(memTypes[h]) && IsGpuType(memTypes[h+1]) && memIndices[h] != memIndices[h+1])
+    {
+      EnablePeerAccess(RemappedIndex(memIndices[h],   false), RemappedIndex(memIndices[h+1], false));
+      EnablePeerAccess(RemappedIndex(memIndices[h+1], false), RemappedIndex(memIndices[h],   false));
+    }
+    hopDevice[h] = RemappedIndex(hopDevice[h], false);
+  }
+
+  // First and last locations hold the full buffer, intermediate locations only hold
+  // enough staging slots for the chunks that may be in flight
+  std::vector<char*>  buffers(numLocs);
+  std::vector<size_t> bufferBytes(numLocs);
+  for (int i = 0; i < numLocs; i++)
+  {
+    bufferBytes[i] = (i == 0 || i == numLocs - 1) ? numBytes : depth * chunkBytes;
+    AcquireMemory(ev, memTypes[i], RemappedIndex(memIndices[i], IsCpuType(memTypes[i])), bufferBytes[i], (void**)&buffers[i]);
+  }
+
+  // Fill source with the usual data pattern
+  size_t const N = numBytes / sizeof(float);
+  std::vector<float> expected(N);
+  for (size_t i = 0; i < N; i++)
+    expected[i] = PrepSrcValue(0, i);
+  HIP_CALL(hipMemcpy(buffers[0], expected.data(), numBytes, hipMemcpyDefault));
+
+  // Each hop runs on its own stream.  doneEvents[h][c] marks chunk c leaving hop h, which either lets the
+  // next hop forward it, or lets the previous hop re-use the staging slot once it has been drained
+  // Chunk timing events are all recorded on the first hop's device so that they can be compared
+  std::vector<hipStream_t>             streams(numHops);
+  std::vector<std::vector<hipEvent_t>> doneEvents(numHops, std::vector<hipEvent_t>(numChunks));
+  for (int h = 0; h < numHops; h++)
+  {
+    HIP_CALL(hipSetDevice(hopDevice[h]));
+    HIP_CALL(hipStreamCreate(&streams[h]));
+    for (size_t c = 0; c < numChunks; c++)
+      HIP_CALL(hipEventCreate(&doneEvents[h][c]));
+  }
+  hipStream_t timingStream;
+  std::vector<hipEvent_t> chunkStart(numChunks), chunkStop(numChunks);
+  HIP_CALL(hipSetDevice(hopDevice[0]));
+  HIP_CALL(hipStreamCreate(&timingStream));
+  for (size_t c = 0; c < numChunks; c++)
+  {
+    HIP_CALL(hipEventCreate(&chunkStart[c]));
+    HIP_CALL(hipEventCreate(&chunkStop[c]));
+  }
+
+  printf("GPU-DMA pipelined Transfer benchmark:\n");
+  printf("==========================\n");
+  printf("- Forwarding %lu bytes through %d hop(s) in %lu chunk(s) of %lu bytes with up to %d chunk(s) in flight\n",
+         numBytes, numHops, numChunks, chunkBytes, depth);
+  if (!ev.outputToCsv)
+  {
+    for (int h = 0; h < numHops; h++)
+      printf("  Hop %02d: %c%d -> %c%d (DMA on GPU %02d)\n", h,
+             MemTypeStr[memTypes[h]], memIndices[h], MemTypeStr[memTypes[h+1]], memIndices[h+1], hopDevice[h]);
+  }
+
+  LatencyHistogram chunkLatency;
+  double totalTimeMsec       = 0;
+  double totalSteadyTimeMsec = 0;
+  double totalCpuTime        = 0;
+  int    numTimedIterations  = 0;
+  for (int iteration = -ev.numWarmups; ; iteration++)
+  {
+    if (ev.numIterations > 0 && iteration    >= ev.numIterations) break;
+    if (ev.numIterations < 0 && totalCpuTime > -ev.numIterations) break;
+
+    auto cpuStart = std::chrono::high_resolution_clock::now();
+
+    // Enqueue chunks in order so that every event is recorded before any stream waits on it
+    for (size_t c = 0; c < numChunks; c++)
+    {
+      size_t const offset = c * chunkBytes;
+      size_t const bytes  = std::min(chunkBytes, numBytes - offset);
+      size_t const slot   = (c % depth) * chunkBytes;
+
+      for (int h = 0; h < numHops; h++)
+      {
+        char* src = buffers[h]   + (h == 0           ? offset : slot);
+        char* dst = buffers[h+1] + (h == numHops - 1 ? offset : slot);
+
+        HIP_CALL(hipSetDevice(hopDevice[h]));
+        // Wait for the previous hop to deliver this chunk
+        if (h > 0)
+          HIP_CALL(hipStreamWaitEvent(streams[h], doneEvents[h-1][c], 0));
+        // Wait for the next hop to drain the staging slot that this chunk overwrites
+        if (h < numHops - 1 && c >= (size_t)depth)
+          HIP_CALL(hipStreamWaitEvent(streams[h], doneEvents[h+1][c - depth], 0));
+        if (h == 0)
+          HIP_CALL(hipEventRecord(chunkStart[c], streams[h]));
+        HIP_CALL(hipMemcpyAsync(dst, src, bytes, hipMemcpyDefault, streams[h]));
+        HIP_CALL(hipEventRecord(doneEvents[h][c], streams[h]));
+      }
+
+      HIP_CALL(hipSetDevice(hopDevice[0]));
+      HIP_CALL(hipStreamWaitEvent(timingStream, doneEvents[numHops-1][c], 0));
+      HIP_CALL(hipEventRecord(chunkStop[c], timingStream));
+    }
+    HIP_CALL(hipStreamSynchronize(timingStream));
+
+    auto cpuDelta = std::chrono::high_resolution_clock::now() - cpuStart;
+    double deltaSec = std::chrono::duration_cast<std::chrono::duration<double>>(cpuDelta).count();
+    if (iteration < 0) continue;
+
+    // Steady-state time excludes filling the pipeline, i.e. covers the completion of all chunks after the first
+    float totalMsec, steadyMsec;
+    HIP_CALL(hipEventElapsedTime(&totalMsec, chunkStart[0], chunkStop[numChunks-1]));
+    HIP_CALL(hipEventElapsedTime(&steadyMsec, chunkStop[0], chunkStop[numChunks-1]));
+    for (size_t c = 0; c < numChunks; c++)
+    {
+      float latencyMsec;
+      HIP_CALL(hipEventElapsedTime(&latencyMsec, chunkStart[c], chunkStop[c]));
+      chunkLatency.Add(latencyMsec);
+    }
+    totalTimeMsec       += totalMsec;
+    totalSteadyTimeMsec += steadyMsec;
+    totalCpuTime        += deltaSec;
+    numTimedIterations++;
+  }
+
+  // Validate that data made it through all hops intact
+  std::vector<float> output(N);
+  HIP_CALL(hipMemcpy(output.data(), buffers[numLocs-1], numBytes, hipMemcpyDefault));
+  for (size_t i = 0; i < N; i++)
+  {
+    if (output[i] != expected[i])
+    {
+      printf("[ERROR] Pipeline output mismatch at element %lu: Expected %f.  Actual: %f\n", i, expected[i], output[i]);
+      exit(1);
+    }
+  }
+
+  if (numTimedIterations > 0)
+  {
+    double const avgTimeMsec      = totalTimeMsec / numTimedIterations;
+    double const overallBwGbs     = (numBytes / 1.0E9) / avgTimeMsec * 1000.0;
+    double const steadyBwGbs      = numChunks > 1 ? ((numBytes - chunkBytes) / 1.0E9) / (totalSteadyTimeMsec / numTimedIterations) * 1000.0
+                                                  : overallBwGbs;
+
+    printf("\nSummary:\n");
+    printf("==========================================================\n");
+    printf("%12s%c%12s%c%6s%c%6s%c%10s%c%12s%c%12s%c%10s%c%10s%c%10s\n",
+           "Bytes", separator, "ChunkBytes", separator, "Hops", separator, "Depth", separator, "Time(ms)", separator,
+           "BW(GB/s)", separator, "Steady(GB/s)", separator, "p50(ms)", separator, "p99(ms)", separator, "Max(ms)");
+    printf("%12lu%c%12lu%c%6d%c%6d%c%10.3f%c%12.2f%c%12.2f%c%10.3f%c%10.3f%c%10.3f\n",
+           numBytes, separator, chunkBytes, separator, numHops, separator, depth, separator, avgTimeMsec, separator,
+           overallBwGbs, separator, steadyBwGbs, separator, chunkLatency.Percentile(50.0), separator,
+           chunkLatency.Percentile(99.0), separator, chunkLatency.Max());
+    if (!ev.outputToCsv) PrintLatencyStats(chunkLatency);
+
+    JsonObject record;
+    record.Add("path", ev.pipelinePath).Add("numBytes", numBytes).Add("chunkBytes", chunkBytes).Add("depth", depth)
+      .Add("timeMs", avgTimeMsec).Add("bandwidthGbs", overallBwGbs).Add("steadyBandwidthGbs", steadyBwGbs)
+      .Add("chunkP50Ms", chunkLatency.Percentile(50.0)).Add("chunkP99Ms", chunkLatency.Percentile(99.0))
+      .Add("chunkMaxMs", chunkLatency.Max());
+    ResultsSink::Get().Write("pipeline", record);
+  }
+
+  // Release resources
+  for (size_t c = 0; c < numChunks; c++)
+  {
+    HIP_CALL(hipEventDestroy(chunkStart[c]));
+    HIP_CALL(hipEventDestroy(chunkStop[c]));
+    for (int h = 0; h < numHops; h++)
+      HIP_CALL(hipEventDestroy(doneEvents[h][c]));
+  }
+  HIP_CALL(hipStreamDestroy(timingStream));
+  for (int h = 0; h < numHops; h++)
+    HIP_CALL(hipStreamDestroy(streams[h]));
+  for (int i = 0; i < numLocs; i++)
+    ReleaseMemory(ev, memTypes[i], buffers[i], bufferBytes[i]);
+}
+
+// Coarse-to-fine search for the value in [minVal, maxVal] (in multiples of step) that maximizes bandwidth
+// Powers-of-two multiples are tried first, then the best value is refined by probing halfway towards its neighbours
+static int SearchTuningParam(int const minVal, int const maxVal, int const step,
+                             std::function<double(int)> const& measure, double& bestBandwidth)
+{
+  std::map<int, double> results;
+  auto evaluate = [&](int const val)
+  {
+    if (val < minVal || val > maxVal || results.count(val)) return;
+    results[val] = measure(val);
+  };
+
+  for (int val = minVal; val < maxVal; val *= 2)
+    evaluate(val);
+  evaluate(maxVal);
+
+  auto best = [&]() {
+    return std::max_element(results.begin(), results.end(),
+                            [](auto const& a, auto const& b) { return a.second < b.second; })->first;
+  };
+
+  int bestVal = best();
+  for (int delta = (bestVal / 2) / step * step; delta >= step; delta = (delta / 2) / step * step)
+  {
+    evaluate(bestVal - delta);
+    evaluate(bestVal + delta);
+    bestVal = best();
+  }
+  bestBandwidth = results[bestVal];
+  return bestVal;
+}
+
+void RunAutotuneBenchmark(EnvVars const& ev, size_t const N, int const maxSubExecs)
+{
+  ev.DisplayAutotuneEnvVars();
+
+  int const numGpus = ev.numGpuDevices;
+  if (numGpus < 1)
+  {
+    printf("[ERROR] Autotune preset requires at least one GPU\n");
+    exit(1);
+  }
+
+  // Enable peer to peer for each GPU
+  for (int i = 0; i < numGpus; i++)
+    for (int j = 0; j < numGpus; j++)
+      if (i != j) EnablePeerAccess(i, j);
+
+  char separator = (ev.outputToCsv ? ',' : ' ');
+
+  // Pick one representative GPU pair for every link class
+  std::vector<std::pair<std::string, Transfer>> linkClasses;
+  auto addLinkClass = [&](int const exeIndex, MemType const srcType, int const srcIndex,
+                          MemType const dstType, int const dstIndex)
+  {
+    Transfer transfer;
+    transfer.numBytes = N * sizeof(float);
+    transfer.numSrcs  = 1;
+    transfer.numDsts  = 1;
+    transfer.exeType  = EXE_GPU_GFX;
+    transfer.exeIndex = exeIndex;
+    transfer.srcType.assign(1, srcType);
+    transfer.srcIndex.assign(1, srcIndex);
+    transfer.dstType.assign(1, dstType);
+    transfer.dstIndex.assign(1, dstIndex);
+
+    std::string const linkClass = GetLinkClass(transfer);
+    for (auto const& entry : linkClasses)
+      if (entry.first == linkClass) return;
+    linkClasses.push_back(std::make_pair(linkClass, transfer));
+  };
+  addLinkClass(0, MEM_GPU, 0, MEM_GPU, 0);
+  addLinkClass(0, MEM_GPU, 0, MEM_CPU, GetClosestNumaNode(RemappedIndex(0, false)));
+  for (int i = 0; i < numGpus; i++)
+    for (int j = 0; j < numGpus; j++)
+      if (i != j) addLinkClass(ev.useRemoteRead ? j : i, MEM_GPU, i, MEM_GPU, j);
+
+  printf("GPU-GFX Autotune benchmark:\n");
+  printf("==========================\n");
+  printf("- Tuning copies of %lu bytes for %lu link class(es) using up to %d SubExecs\n",
+         N * sizeof(float), linkClasses.size(), maxSubExecs);
+  printf("- Searching #SubExecs, GPU_KERNEL unroll, BLOCK_SIZE, BLOCK_BYTES and USE_XCC_FILTER\n\n");
+
+  printf("%-10s%c%-12s%c%8s%c%10s%c%9s%c%10s%c%9s%c%6s%c%10s\n",
+         "LinkClass", separator, "Transfer", separator, "SubExecs", separator, "GpuKernel", separator,
+         "BlockSize", separator, "BlockBytes", separator, "XccFilter", separator, "Evals", separator, "BW(GB/s)");
+
+  std::map<std::string, TuningEntry> tuningTable;
+  for (auto& linkClass : linkClasses)
+  {
+    std::vector<Transfer> transfers(1, linkClass.second);
+    Transfer& transfer = transfers[0];
+    int const exeIndex = transfer.exeIndex;
+
+    // Start from the current settings
+    EnvVars tuneEv = ev;
+    tuneEv.useXccFilter = 0;
+    transfer.numSubExecs = std::min(maxSubExecs, 8);
+
+    int numEvals = 0;
+    auto measure = [&]()
+    {
+      ExecuteTransfers(tuneEv, 0, N, transfers, false);
+      numEvals++;
+      double const transferDurationMsec = transfer.transferTime / (1.0 * transfer.numTimedIterations);
+      return (transfer.numBytesActual / 1.0E9) / transferDurationMsec * 1000.0;
+    };
+
+    // Coordinate descent: tune one parameter at a time, then revisit #SubExecs with all other parameters chosen
+    double bestBandwidth = 0;
+    transfer.numSubExecs = SearchTuningParam(1, maxSubExecs, 1,
+                                             [&](int val) { transfer.numSubExecs = val; return measure(); },
+                                             bestBandwidth);
+
+    // Unrolled kernels are indexed by their unroll factor. The alternate 8xUnroll kernel has restrictions
+    tuneEv.gpuKernel = SearchTuningParam(1, GPU_KERNEL_UNROLL_B - 1, 1,
+                                         [&](int val) { tuneEv.gpuKernel = val; return measure(); },
+                                         bestBandwidth);
+    for (int altKernel : {GPU_KERNEL_UNROLL_B, GPU_KERNEL_STEAL})
+    {
+      if (tuneEv.useWaveSubExec || (altKernel == GPU_KERNEL_UNROLL_B && tuneEv.dataType != DATA_FP32)) continue;
+      int const prevKernel = tuneEv.gpuKernel;
+      tuneEv.gpuKernel = altKernel;
+      double const bandwidth = measure();
+      if (bandwidth > bestBandwidth)
+        bestBandwidth = bandwidth;
+      else
+        tuneEv.gpuKernel = prevKernel;
+    }
+
+    tuneEv.blockSize = SearchTuningParam(64, MAX_BLOCKSIZE, 64,
+                                         [&](int val) { tuneEv.blockSize = val; return measure(); },
+                                         bestBandwidth);
+    tuneEv.blockBytes = SearchTuningParam(64, 4096, 64,
+                                          [&](int val) { tuneEv.blockBytes = val; return measure(); },
+                                          bestBandwidth);
+
+    // XCC filtering only matters for GPUs with multiple XCCs
+    if (ev.xccIdsPerDevice[exeIndex].size() > 1)
+    {
+      tuneEv.useXccFilter = 1;
+      double const bandwidth = measure();
+      if (bandwidth > bestBandwidth)
+        bestBandwidth = bandwidth;
+      else
+        tuneEv.useXccFilter = 0;
+    }
+
+    transfer.numSubExecs = SearchTuningParam(1, maxSubExecs, 1,
+                                             [&](int val) { transfer.numSubExecs = val; return measure(); },
+                                             bestBandwidth);
+
+    TuningEntry& entry = tuningTable[linkClass.first];
+    entry.numSubExecs  = transfer.numSubExecs;
+    entry.gpuKernel    = tuneEv.gpuKernel;
+    entry.blockSize    = tuneEv.blockSize;
+    entry.blockBytes   = tuneEv.blockBytes;
+    entry.useXccFilter = tuneEv.useXccFilter;
+    entry.bandwidthGbs = bestBandwidth;
+
+    char transferStr[32];
+    sprintf(transferStr, "G%d->G%d->%c%d", transfer.srcIndex[0], exeIndex,
+            MemTypeStr[transfer.dstType[0]], transfer.dstIndex[0]);
+    printf("%-10s%c%-12s%c%8d%c%10d%c%9d%c%10d%c%9d%c%6d%c%10.2f\n",
+           linkClass.first.c_str(), separator, transferStr, separator, entry.numSubExecs, separator,
+           entry.gpuKernel, separator, entry.blockSize, separator, entry.blockBytes, separator,
+           entry.useXccFilter, separator, numEvals, separator, entry.bandwidthGbs);
+
+    JsonObject record;
+    record.Add("linkClass", linkClass.first).Add("transfer", std::string(transferStr)).Add("numBytes", N * sizeof(float))
+      .Add("numSubExecs", entry.numSubExecs).Add("gpuKernel", entry.gpuKernel).Add("blockSize", entry.blockSize)
+      .Add("blockBytes", entry.blockBytes).Add("useXccFilter", entry.useXccFilter).Add("numEvals", numEvals)
+      .Add("bandwidthGbs", entry.bandwidthGbs);
+    ResultsSink::Get().Write("autotune", record);
+  }
 
-          for (int dir = 0; dir <= isBidirectional; dir++)
-          {
-            double const avgTime = transfers[dir].transferTime / ev.numIterations;
-            double const avgBw   = (transfers[dir].numBytesActual / 1.0E9) / avgTime * 1000.0f;
-            avgBandwidth[dir].push_back(avgBw);
+  // Write tuning table for use by Tests that request "auto" #SubExecs
+  FILE* fp = fopen(ev.autotuneFile.c_str(), "w");
+  if (!fp)
+  {
+    printf("[ERROR] Unable to open autotune file [%s] for writing\n", ev.autotuneFile.c_str());
+    exit(1);
+  }
+  fprintf(fp, "# TransferBench v%s autotune table (%lu bytes per Transfer)\n", TB_VERSION, N * sizeof(float));
+  fprintf(fp, "# LinkClass NumSubExecs GpuKernel BlockSize BlockBytes XccFilter BW(GB/s)\n");
+  for (auto const& linkClass : linkClasses)
+  {
+    TuningEntry const& entry = tuningTable[linkClass.first];
+    fprintf(fp, "%s %d %d %d %d %d %.2f\n", linkClass.first.c_str(), entry.numSubExecs, entry.gpuKernel,
+            entry.blockSize, entry.blockBytes, entry.useXccFilter, entry.bandwidthGbs);
+  }
+  fclose(fp);
+  printf("\nTuning table written to %s\n", ev.autotuneFile.c_str());
+}
 
-            if (!(srcType == dstType && srcIndex == dstIndex))
-            {
-              avgBwSum[srcType][dstType] += avgBw;
-              avgCount[srcType][dstType]++;
-            }
+std::string GetLinkClass(Transfer const& transfer)
+{
+  // Classify by the first GPU memory location on a different GPU than the executor, otherwise by host memory
+  bool usesHostMem = false;
+  for (int i = 0; i < transfer.numSrcs + transfer.numDsts; i++)
+  {
+    MemType const memType  = (i < transfer.numSrcs ? transfer.srcType[i]  : transfer.dstType[i - transfer.numSrcs]);
+    int     const memIndex = (i < transfer.numSrcs ? transfer.srcIndex[i] : transfer.dstIndex[i - transfer.numSrcs]);
+    if (IsCpuType(memType)) usesHostMem = true;
+    if (IsGpuType(memType) && memIndex != transfer.exeIndex)
+    {
+#if defined(__NVCC__)
+      return "PEER";
+#else
+      uint32_t linkType, hopCount;
+      HIP_CALL(hipExtGetLinkTypeAndHopCount(RemappedIndex(transfer.exeIndex, false),
+                                            RemappedIndex(memIndex, false),
+                                            &linkType, &hopCount));
+      return GetLinkTypeDesc(linkType, hopCount);
+#endif
+    }
+  }
+  return usesHostMem ? "HOST" : "LOCAL";
+}
 
-            if (ev.showIterations)
-            {
-              double minTime = transfers[dir].perIterationTime[0];
-              double maxTime = transfers[dir].perIterationTime[0];
-              double varSum  = 0;
-              for (int i = 0; i < transfers[dir].perIterationTime.size(); i++)
-              {
-                minTime = std::min(minTime, transfers[dir].perIterationTime[i]);
-                maxTime = std::max(maxTime, transfers[dir].perIterationTime[i]);
-                double const bw  = (transfers[dir].numBytesActual / 1.0E9) / transfers[dir].perIterationTime[i] * 1000.0f;
-                double const delta = (avgBw - bw);
-                varSum += delta * delta;
-              }
-              double const minBw = (transfers[dir].numBytesActual / 1.0E9) / maxTime * 1000.0f;
-              double const maxBw = (transfers[dir].numBytesActual / 1.0E9) / minTime * 1000.0f;
-              double const stdev = sqrt(varSum / transfers[dir].perIterationTime.size());
-              minBandwidth[dir].push_back(minBw);
-              maxBandwidth[dir].push_back(maxBw);
-              stdDev[dir].push_back(stdev);
-            }
-          }
-        }
-        else
-        {
-          for (int dir = 0; dir <= isBidirectional; dir++)
-          {
-            avgBandwidth[dir].push_back(0);
-            minBandwidth[dir].push_back(0);
-            maxBandwidth[dir].push_back(0);
-            stdDev[dir].push_back(-1.0);
-          }
-        }
+void ResolveAutoSubExecs(EnvVars const& ev, std::vector<Transfer>& transfers)
+{
+  static std::map<std::string, TuningEntry> tuningTable;
+  static bool isLoaded = false;
+
+  for (Transfer& transfer : transfers)
+  {
+    if (transfer.numSubExecs != AUTO_SUBEXECS) continue;
+
+    if (transfer.exeType != EXE_GPU_GFX)
+    {
+      InputError("Automatic #SubExecs is only supported for GPU GFX executors");
+    }
+
+    // Load tuning table produced by the autotune preset
+    if (!isLoaded)
+    {
+      FILE* fp = fopen(ev.autotuneFile.c_str(), "r");
+      if (!fp)
+      {
+        InputError("Unable to open autotune file [%s].  Run the autotune preset first", ev.autotuneFile.c_str());
+      }
+      char line[MAX_LINE_LEN];
+      while (fgets(line, MAX_LINE_LEN, fp))
+      {
+        if (line[0] == '#') continue;
+        char linkClass[64];
+        TuningEntry entry;
+        if (sscanf(line, "%63s %d %d %d %d %d %lf", linkClass, &entry.numSubExecs, &entry.gpuKernel,
+                   &entry.blockSize, &entry.blockBytes, &entry.useXccFilter, &entry.bandwidthGbs) == 7)
+          tuningTable[linkClass] = entry;
       }
+      fclose(fp);
+      isLoaded = true;
+    }
 
-      for (int dir = 0; dir <= isBidirectional; dir++)
+    std::string const linkClass = GetLinkClass(transfer);
+    if (!tuningTable.count(linkClass))
+    {
+      InputError("Autotune file [%s] has no entry for link class %s", ev.autotuneFile.c_str(), linkClass.c_str());
+    }
+    TuningEntry const& entry = tuningTable[linkClass];
+    transfer.numSubExecs = entry.numSubExecs;
+
+    // The #SubExecs was only found to be the best in combination with the other settings of the entry
+    std::string mismatches;
+    auto checkSetting = [&](char const* name, int const tunedValue, int const currValue)
+    {
+      if (tunedValue == currValue) return;
+      mismatches += std::string(mismatches.empty() ? "" : ", ") + name + "=" + std::to_string(currValue) +
+        " (tuned with " + std::to_string(tunedValue) + ")";
+    };
+    checkSetting("GPU_KERNEL",     entry.gpuKernel,    ev.gpuKernel);
+    checkSetting("BLOCK_SIZE",     entry.blockSize,    ev.blockSize);
+    checkSetting("BLOCK_BYTES",    entry.blockBytes,   ev.blockBytes);
+    checkSetting("USE_XCC_FILTER", entry.useXccFilter, ev.useXccFilter);
+
+    // Only warn once per link class and set of mismatched settings
+    static std::set<std::string> warnedMismatches;
+    if (!mismatches.empty() && warnedMismatches.insert(linkClass + ":" + mismatches).second)
+    {
+      printf("[WARN] Automatic #SubExecs (%d) for link class %s may not be optimal as current settings differ from %s: %s\n",
+             entry.numSubExecs, linkClass.c_str(), ev.autotuneFile.c_str(), mismatches.c_str());
+    }
+  }
+}
+
+void RunContentionBenchmark(EnvVars const& ev, size_t const N)
+{
+  ev.DisplayContentionEnvVars();
+
+  int const numGpus = ev.numGpuDevices;
+  if (numGpus < 2)
+  {
+    printf("[ERROR] Contention benchmark requires at least 2 GPUs\n");
+    exit(1);
+  }
+
+  // Enable peer to peer for each GPU
+  for (int i = 0; i < numGpus; i++)
+    for (int j = 0; j < numGpus; j++)
+      if (i != j) EnablePeerAccess(i, j);
+
+  char const separator = ev.outputToCsv ? ',' : ' ';
+
+  // Each flow is a unidirectional peer-to-peer copy between a pair of GPUs
+  MemType const memType    = ev.useFineGrain ? MEM_GPU_FINE : MEM_GPU;
+  ExeType const gpuExeType = ev.useDmaCopy   ? EXE_GPU_DMA  : EXE_GPU_GFX;
+  std::vector<Transfer> flows;
+  std::vector<bool>     isDirectXgmi;
+  for (int src = 0; src < numGpus; src++)
+  {
+    for (int dst = 0; dst < numGpus; dst++)
+    {
+      if (src == dst) continue;
+      Transfer flow;
+      flow.numBytes    = N * sizeof(float);
+      flow.numSrcs     = flow.numDsts = 1;
+      flow.srcType     = {memType};
+      flow.srcIndex    = {src};
+      flow.dstType     = {memType};
+      flow.dstIndex    = {dst};
+      flow.exeType     = gpuExeType;
+      flow.exeIndex    = ev.useRemoteRead ? dst : src;
+      flow.numSubExecs = ev.numGpuSubExecs;
+      flows.push_back(flow);
+
+      bool isDirect = false;
+#if !defined(__NVCC__)
+      uint32_t linkType, hopCount;
+      HIP_CALL(hipExtGetLinkTypeAndHopCount(RemappedIndex(src, false), RemappedIndex(dst, false),
+                                            &linkType, &hopCount));
+      isDirect = (linkType == HSA_AMD_LINK_INFO_TYPE_XGMI && hopCount == 1);
+#endif
+      isDirectXgmi.push_back(isDirect);
+    }
+  }
+  int const numFlows = flows.size();
+
+  auto flowBandwidth = [&](Transfer const& transfer)
+  {
+    double const avgTime = transfer.transferTime / transfer.numTimedIterations;
+    return (transfer.numBytesActual / 1.0E9) / avgTime * 1000.0;
+  };
+
+  // Flows on dedicated single-hop XGMI links between disjoint GPUs cannot share a link, so are not measured
+  auto mayInterfere = [&](int const a, int const b)
+  {
+    if (ev.contentionAll) return true;
+    std::set<int> gpusA = {flows[a].srcIndex[0], flows[a].dstIndex[0]};
+    for (int gpu : {flows[b].srcIndex[0], flows[b].dstIndex[0]})
+      if (gpusA.count(gpu)) return true;
+    return !(isDirectXgmi[a] && isDirectXgmi[b]);
+  };
+
+  int numPairs = 0;
+  for (int a = 0; a < numFlows; a++)
+    for (int b = a + 1; b < numFlows; b++)
+      numPairs += mayInterfere(a, b);
+
+  printf("GPU-%s Link contention benchmark:\n", ev.useDmaCopy ? "DMA" : "GFX");
+  printf("==========================\n");
+  printf("- Copying %lu bytes per flow for %d flows, measuring %d of %d flow pairs\n",
+         N * sizeof(float), numFlows, numPairs, numFlows * (numFlows - 1) / 2);
+  printf("- Entry [row][col] is the %% of the row flow's standalone bandwidth achieved while the column flow runs\n\n");
+
+  // Measure standalone bandwidth of each flow
+  std::vector<double> soloBandwidth(numFlows);
+  for (int a = 0; a < numFlows; a++)
+  {
+    std::vector<Transfer> transfers = {flows[a]};
+    ExecuteTransfers(ev, 0, N, transfers, false);
+    soloBandwidth[a] = flowBandwidth(transfers[0]);
+  }
+
+  // Measure each pair of flows that may interfere concurrently
+  std::vector<std::vector<double>> retained(numFlows, std::vector<double>(numFlows, -1.0));
+  for (int a = 0; a < numFlows; a++)
+  {
+    for (int b = a + 1; b < numFlows; b++)
+    {
+      if (!mayInterfere(a, b)) continue;
+      std::vector<Transfer> transfers = {flows[a], flows[b]};
+      ExecuteTransfers(ev, 0, N, transfers, false);
+      retained[a][b] = 100.0 * flowBandwidth(transfers[0]) / soloBandwidth[a];
+      retained[b][a] = 100.0 * flowBandwidth(transfers[1]) / soloBandwidth[b];
+    }
+  }
+
+  auto flowName = [&](int const a)
+  {
+    char name[16];
+    sprintf(name, "G%d>G%d", flows[a].srcIndex[0], flows[a].dstIndex[0]);
+    return std::string(name);
+  };
+
+  printf("%7s%c%8s", "Flow", separator, "BW(GB/s)");
+  for (int b = 0; b < numFlows; b++)
+    printf("%c%7s", separator, flowName(b).c_str());
+  printf("\n");
+  for (int a = 0; a < numFlows; a++)
+  {
+    printf("%7s%c%8.2f", flowName(a).c_str(), separator, soloBandwidth[a]);
+    for (int b = 0; b < numFlows; b++)
+    {
+      if (a == b)
+        printf("%c%7s", separator, "-");
+      else if (retained[a][b] < 0)
+        printf("%c%7s", separator, ".");
+      else
+        printf("%c%7.1f", separator, retained[a][b]);
+    }
+    printf("\n");
+  }
+  printf("(\".\" = not measured as flows use separate direct XGMI links)\n");
+
+  // One record per measured pair of flows
+  for (int a = 0; a < numFlows; a++)
+    for (int b = a + 1; b < numFlows; b++)
+      if (retained[a][b] >= 0)
       {
-        printf("%5s %02d %3s", (srcType == MEM_CPU) ? "CPU" : "GPU", srcIndex, dir ? "<- " : " ->");
-        if (ev.outputToCsv) printf(",");
+        JsonObject record;
+        record.Add("flowA", flowName(a)).Add("flowB", flowName(b)).Add("numBytes", N * sizeof(float))
+          .Add("soloBandwidthGbsA", soloBandwidth[a]).Add("soloBandwidthGbsB", soloBandwidth[b])
+          .Add("retainedPctA", retained[a][b]).Add("retainedPctB", retained[b][a]);
+        ResultsSink::Get().Write("contention", record);
+      }
 
-        for (int dst = 0; dst < numDevices; dst++)
-        {
-          if (dst == numCpus && dst != 0) printf("   ");
-          double const avgBw = avgBandwidth[dir][dst];
+  // Summarize the pairs of flows with the largest slowdown
+  std::vector<std::tuple<double, int, int>> worstPairs;
+  for (int a = 0; a < numFlows; a++)
+    for (int b = a + 1; b < numFlows; b++)
+      if (retained[a][b] >= 0)
+        worstPairs.push_back(std::make_tuple(std::min(retained[a][b], retained[b][a]), a, b));
+  std::sort(worstPairs.begin(), worstPairs.end());
+
+  int const numWorst = std::min((int)worstPairs.size(), 10);
+  printf("\nMost interfering flow pairs:\n");
+  for (int i = 0; i < numWorst; i++)
+  {
+    int const a = std::get<1>(worstPairs[i]);
+    int const b = std::get<2>(worstPairs[i]);
+    printf("%7s%c%7s%c%7.1f%%%c%7.1f%%\n", flowName(a).c_str(), separator, flowName(b).c_str(), separator,
+           retained[a][b], separator, retained[b][a]);
+  }
+}
 
-          if (avgBw == 0.0)
-            printf("%10s", "N/A");
-          else
-            printf("%10.2f", avgBw);
-          if (ev.outputToCsv) printf(",");
-        }
-        printf("\n");
+bool RunHealthcheckPreset(EnvVars const& ev, size_t const N)
+{
+  ev.DisplayHealthcheckEnvVars();
 
-        if (ev.showIterations)
-        {
-          // minBw
-          printf("%5s %02d %3s", (srcType == MEM_CPU) ? "CPU" : "GPU", srcIndex, "min");
-          if (ev.outputToCsv) printf(",");
-          for (int i = 0; i < numDevices; i++)
-          {
-            double const minBw = minBandwidth[dir][i];
-            if (i == numCpus && i != 0) printf("   ");
-            if (minBw == 0.0)
-              printf("%10s", "N/A");
-            else
-              printf("%10.2f", minBw);
-            if (ev.outputToCsv) printf(",");
-          }
-          printf("\n");
+  int const numCpus = ev.numCpuDevices;
+  int const numGpus = ev.numGpuDevices;
+  if (numGpus < 1)
+  {
+    printf("[ERROR] Healthcheck preset requires at least 1 GPU\n");
+    exit(1);
+  }
+  if (ev.numIterations <= 0)
+  {
+    printf("[ERROR] Healthcheck preset requires NUM_ITERATIONS to be set to a positive number\n");
+    exit(1);
+  }
 
-          // maxBw
-          printf("%5s %02d %3s", (srcType == MEM_CPU) ? "CPU" : "GPU", srcIndex, "max");
-          if (ev.outputToCsv) printf(",");
-          for (int i = 0; i < numDevices; i++)
-          {
-            double const maxBw = maxBandwidth[dir][i];
-            if (i == numCpus && i != 0) printf("   ");
-            if (maxBw == 0.0)
-              printf("%10s", "N/A");
-            else
-              printf("%10.2f", maxBw);
-            if (ev.outputToCsv) printf(",");
-          }
-          printf("\n");
+  // Enable peer to peer for each GPU
+  for (int i = 0; i < numGpus; i++)
+    for (int j = 0; j < numGpus; j++)
+      if (i != j) EnablePeerAccess(i, j);
 
-          // stddev
-          printf("%5s %02d %3s", (srcType == MEM_CPU) ? "CPU" : "GPU", srcIndex, " sd");
-          if (ev.outputToCsv) printf(",");
-          for (int i = 0; i < numDevices; i++)
-          {
-            double const sd = stdDev[dir][i];
-            if (i == numCpus && i != 0) printf("   ");
-            if (sd == -1.0)
-              printf("%10s", "N/A");
-            else
-              printf("%10.2f", sd);
-            if (ev.outputToCsv) printf(",");
-          }
-          printf("\n");
-        }
-        fflush(stdout);
+  // Load expected bandwidth per link class (same format as the link class summary below)
+  std::map<std::string, double> expectedGbs;
+  if (!ev.hcExpectedFile.empty())
+  {
+    FILE* fp = fopen(ev.hcExpectedFile.c_str(), "r");
+    if (!fp)
+    {
+      printf("[ERROR] Unable to open healthcheck expected file [%s]\n", ev.hcExpectedFile.c_str());
+      exit(1);
+    }
+    char line[MAX_LINE_LEN];
+    while (fgets(line, MAX_LINE_LEN, fp))
+    {
+      if (line[0] == '#') continue;
+      char linkClass[64];
+      double bandwidthGbs;
+      if (sscanf(line, "%63s %lf", linkClass, &bandwidthGbs) == 2)
+        expectedGbs[linkClass] = bandwidthGbs;
+    }
+    fclose(fp);
+  }
+
+  MemType const gpuMemType = ev.useFineGrain ? MEM_GPU_FINE : MEM_GPU;
+  auto makeTransfer = [&](MemType srcType, int srcIndex, ExeType exeType, int exeIndex,
+                          MemType dstType, int dstIndex, int numSubExecs)
+  {
+    Transfer transfer;
+    transfer.numBytes    = N * sizeof(float);
+    transfer.numSrcs     = transfer.numDsts = 1;
+    transfer.srcType     = {srcType};
+    transfer.srcIndex    = {srcIndex};
+    transfer.dstType     = {dstType};
+    transfer.dstIndex    = {dstIndex};
+    transfer.exeType     = exeType;
+    transfer.exeIndex    = exeIndex;
+    transfer.numSubExecs = numSubExecs;
+    return transfer;
+  };
+
+  // Each check is one Test of concurrently executed Transfers, with a link class per Transfer
+  enum { HC_HOST, HC_XGMI, HC_A2A, HC_DMA, NUM_HC_CATEGORIES };
+  char const categoryName[NUM_HC_CATEGORIES][8] = {"HOST", "XGMI", "A2A", "DMA"};
+  struct HealthCheck
+  {
+    int                      category;
+    std::vector<Transfer>    transfers;
+    std::vector<std::string> linkClasses;
+  };
+  std::vector<HealthCheck> checks;
+
+  // - Bidirectional CPU <-> GPU over every NUMA node
+  for (int cpu = 0; cpu < numCpus; cpu++)
+  {
+    for (int gpu = 0; gpu < numGpus; gpu++)
+    {
+      bool const isLocal = (GetClosestNumaNode(RemappedIndex(gpu, false)) == RemappedIndex(cpu, true));
+      std::string const locality = isLocal ? "LOCAL" : "REMOTE";
+      HealthCheck check;
+      check.category  = HC_HOST;
+      check.transfers = {makeTransfer(MEM_CPU, cpu, EXE_GPU_GFX, gpu, gpuMemType, gpu, ev.numGpuSubExecs),
+                         makeTransfer(gpuMemType, gpu, EXE_GPU_GFX, gpu, MEM_CPU, cpu, ev.numGpuSubExecs)};
+      check.linkClasses = {"H2D-" + locality, "D2H-" + locality};
+      checks.push_back(check);
+    }
+  }
+
+  // - Bidirectional copies over every direct XGMI link
+  std::vector<std::vector<bool>> isDirect(numGpus, std::vector<bool>(numGpus, false));
+  for (int i = 0; i < numGpus; i++)
+  {
+    for (int j = 0; j < numGpus; j++)
+    {
+      if (i == j) continue;
+      std::string linkClass = "PEER";
+#if !defined(__NVCC__)
+      uint32_t linkType, hopCount;
+      HIP_CALL(hipExtGetLinkTypeAndHopCount(RemappedIndex(i, false), RemappedIndex(j, false), &linkType, &hopCount));
+      if (linkType != HSA_AMD_LINK_INFO_TYPE_XGMI || hopCount != 1) continue;
+      linkClass = GetLinkTypeDesc(linkType, hopCount);
+#endif
+      isDirect[i][j] = true;
+      if (j < i) continue;
+
+      HealthCheck check;
+      check.category    = HC_XGMI;
+      check.transfers   = {makeTransfer(gpuMemType, i, EXE_GPU_GFX, i, gpuMemType, j, ev.numGpuSubExecs),
+                           makeTransfer(gpuMemType, j, EXE_GPU_GFX, j, gpuMemType, i, ev.numGpuSubExecs)};
+      check.linkClasses = {linkClass, linkClass};
+      checks.push_back(check);
+    }
+  }
+
+  // - All-to-all across directly connected GPUs (CUs of each GPU are split across its outgoing Transfers)
+  {
+    HealthCheck check;
+    check.category = HC_A2A;
+    for (int i = 0; i < numGpus; i++)
+    {
+      int const numPeers = std::count(isDirect[i].begin(), isDirect[i].end(), true);
+      for (int j = 0; j < numGpus; j++)
+      {
+        if (!isDirect[i][j]) continue;
+        check.transfers.push_back(makeTransfer(gpuMemType, i, EXE_GPU_GFX, i, gpuMemType, j,
+                                               std::max(1, ev.numGpuSubExecs / numPeers)));
+        check.linkClasses.push_back("A2A");
+      }
+    }
+    if (check.transfers.size() > 2) checks.push_back(check);
+  }
+
+  // - Device-to-host DMA copy per SDMA engine (or per GPU when DMA Transfers are executed via HIP)
+  for (int gpu = 0; gpu < numGpus; gpu++)
+  {
+    int const closestNuma = GetClosestNumaNode(RemappedIndex(gpu, false));
+    int cpu = 0;
+    for (int i = 0; i < numCpus; i++)
+      if (RemappedIndex(i, true) == closestNuma) cpu = i;
+
+    std::vector<int> engines = {-1};
+#if !defined(__NVCC__)
+    if (ev.useHsaDma)
+    {
+      AgentData& agentData = GetAgentData();
+      uint32_t engineIdMask = 0;
+      HSA_CHECK(hsa_amd_memory_copy_engine_status(agentData.cpuAgents[RemappedIndex(cpu, true)],
+                                                  agentData.gpuAgents[RemappedIndex(gpu, false)], &engineIdMask));
+      engines.clear();
+      for (int i = 0; i < 32; i++)
+        if (engineIdMask & (1U << i)) engines.push_back(i);
+    }
+#endif
+    for (int engine : engines)
+    {
+      HealthCheck check;
+      check.category  = HC_DMA;
+      check.transfers = {makeTransfer(gpuMemType, gpu, EXE_GPU_DMA, gpu, MEM_CPU, cpu, 1)};
+      check.transfers[0].exeSubIndex = engine;
+      check.linkClasses = {"DMA"};
+      checks.push_back(check);
+    }
+  }
+
+  int const numChecks = checks.size();
+  printf("Node health check:\n");
+  printf("==========================\n");
+  printf("- Running %d Tests of %lu bytes per Transfer", numChecks, N * sizeof(float));
+  if (ev.hcTimeLimit) printf(" within %d seconds", ev.hcTimeLimit);
+  printf("\n\n");
+
+  // Buffers are pooled across Tests and iterations are enqueued back-to-back to minimize overhead
+  EnvVars hcEv = ev;
+  hcEv.useMemPool     = 1;
+  hcEv.useAsyncLaunch = !ev.useHsaDma;
+  EnvVars a2aEv = hcEv;
+  a2aEv.useSingleStream = 1;
+
+  // The # of iterations of each Test is reduced if needed to fit the remaining time budget, based on the
+  // observed time per iteration of previous Tests of the same category
+  std::vector<double> secPerIteration(NUM_HC_CATEGORIES, 0.0);
+  std::vector<int>    numIterationsRun(numChecks, 0);
+  auto const startTime = std::chrono::high_resolution_clock::now();
+  auto elapsedSec = [&]()
+  {
+    auto const delta = std::chrono::high_resolution_clock::now() - startTime;
+    return std::chrono::duration_cast<std::chrono::duration<double>>(delta).count();
+  };
+
+  int numSkipped = 0;
+  for (int i = 0; i < numChecks; i++)
+  {
+    HealthCheck& check = checks[i];
+    EnvVars& testEv = (check.category == HC_A2A ? a2aEv : hcEv);
+    testEv.numIterations = ev.numIterations;
+
+    if (ev.hcTimeLimit)
+    {
+      double const remainingSec = ev.hcTimeLimit - elapsedSec();
+      if (remainingSec <= 0)
+      {
+        numSkipped = numChecks - i;
+        break;
       }
 
-      if (isBidirectional)
+      double estimate = secPerIteration[check.category];
+      if (estimate == 0.0)
+        estimate = *std::max_element(secPerIteration.begin(), secPerIteration.end());
+      if (estimate > 0.0)
       {
-        printf("%5s %02d %3s", (srcType == MEM_CPU) ? "CPU" : "GPU", srcIndex, "<->");
-        if (ev.outputToCsv) printf(",");
-        for (int dst = 0; dst < numDevices; dst++)
-        {
-          double const sumBw = avgBandwidth[0][dst] + avgBandwidth[1][dst];
-          if (dst == numCpus && dst != 0) printf("   ");
-          if (sumBw == 0.0)
-            printf("%10s", "N/A");
-          else
-            printf("%10.2f", sumBw);
-          if (ev.outputToCsv) printf(",");
-        }
-        printf("\n");
-        if (src < numDevices - 1) printf("\n");
+        double const allowanceSec = remainingSec / (numChecks - i);
+        int const affordable = (int)(allowanceSec / estimate) - ev.numWarmups;
+        testEv.numIterations = std::max(1, std::min(ev.numIterations, affordable));
       }
     }
 
-    if (!ev.outputToCsv)
+    double const testStartSec = elapsedSec();
+    ExecuteTransfers(testEv, i + 1, N, check.transfers, false);
+    numIterationsRun[i] = check.transfers.empty() ? testEv.numIterations : check.transfers[0].numTimedIterations;
+    secPerIteration[check.category] = (elapsedSec() - testStartSec) / (numIterationsRun[i] + ev.numWarmups);
+  }
+  int const numRun = numChecks - numSkipped;
+
+  // Gather measured bandwidth per link class
+  std::vector<std::vector<double>> measuredGbs(numRun);
+  std::map<std::string, std::vector<double>> classBandwidths;
+  for (int i = 0; i < numRun; i++)
+  {
+    for (int j = 0; j < checks[i].transfers.size(); j++)
     {
-      printf("                         ");
-      for (int srcType : {MEM_CPU, MEM_GPU})
-        for (int dstType : {MEM_CPU, MEM_GPU})
-          printf("  %cPU->%cPU", srcType == MEM_CPU ? 'C' : 'G', dstType == MEM_CPU ? 'C' : 'G');
-      printf("\n");
+      Transfer const& transfer = checks[i].transfers[j];
+      double const avgTime = transfer.transferTime / transfer.numTimedIterations;
+      measuredGbs[i].push_back((transfer.numBytesActual / 1.0E9) / avgTime * 1000.0);
+      classBandwidths[checks[i].linkClasses[j]].push_back(measuredGbs[i][j]);
+    }
+  }
 
-      printf("Averages (During %s):",  isBidirectional ? " BiDir" : "UniDir");
-      for (int srcType : {MEM_CPU, MEM_GPU})
-        for (int dstType : {MEM_CPU, MEM_GPU})
-        {
-          if (avgCount[srcType][dstType])
-            printf("%10.2f", avgBwSum[srcType][dstType] / avgCount[srcType][dstType]);
-          else
-            printf("%10s", "N/A");
-        }
-      printf("\n\n");
+  // Expected bandwidth of a link class is taken from the expected file, or the median of its measurements
+  std::map<std::string, double> classExpectedGbs;
+  for (auto& classPair : classBandwidths)
+  {
+    std::vector<double>& values = classPair.second;
+    std::sort(values.begin(), values.end());
+    auto it = expectedGbs.find(classPair.first);
+    classExpectedGbs[classPair.first] = (it != expectedGbs.end() ? it->second : values[values.size() / 2]);
+  }
+
+  char const separator = ev.outputToCsv ? ',' : ' ';
+  int numFailed = 0;
+  printf("%5s%c%4s%c%-12s%c%-16s%c%10s%c%10s%c%6s\n", "Test", separator, "Cat", separator, "Transfer", separator,
+         "LinkClass", separator, "BW(GB/s)", separator, "Expected", separator, "Result");
+  for (int i = 0; i < numRun; i++)
+  {
+    for (int j = 0; j < checks[i].transfers.size(); j++)
+    {
+      Transfer const& transfer  = checks[i].transfers[j];
+      std::string const& linkClass = checks[i].linkClasses[j];
+      double const expected = classExpectedGbs[linkClass];
+      bool const isPass     = measuredGbs[i][j] >= expected * (1.0 - ev.hcTolerance / 100.0) &&
+                              measuredGbs[i][j] >= ev.hcMinBw;
+      numFailed += !isPass;
+
+      char name[32];
+      sprintf(name, "%s>%c%d>%s", transfer.SrcToStr().c_str(), ExeTypeStr[transfer.exeType], transfer.exeIndex,
+              transfer.DstToStr().c_str());
+      if (transfer.exeSubIndex != -1)
+        sprintf(name + strlen(name), ".%d", transfer.exeSubIndex);
+      printf("%5d%c%4s%c%-12s%c%-16s%c%10.2f%c%10.2f%c%6s\n", i + 1, separator, categoryName[checks[i].category],
+             separator, name, separator, linkClass.c_str(), separator, measuredGbs[i][j], separator, expected,
+             separator, isPass ? "PASS" : "FAIL");
+
+      JsonObject record;
+      record.Add("category", categoryName[checks[i].category]).Add("testNum", i + 1)
+        .Add("src", transfer.SrcToStr()).Add("exe", std::string(1, ExeTypeStr[transfer.exeType]) + std::to_string(transfer.exeIndex))
+        .Add("dst", transfer.DstToStr()).Add("linkClass", linkClass).Add("numIterations", numIterationsRun[i])
+        .Add("bandwidthGbs", measuredGbs[i][j]).Add("expectedGbs", expected).Add("pass", isPass);
+      if (transfer.exeSubIndex != -1) record.Add("exeSubIndex", transfer.exeSubIndex);
+      ResultsSink::Get().Write("healthcheck", record);
     }
   }
+
+  // Link class summary may be saved as HC_EXPECTED_FILE for subsequent health checks
+  printf("\n# Link class summary (LinkClass ExpectedGbs Min Max Count)\n");
+  for (auto const& classPair : classBandwidths)
+    printf("%-16s %10.2f %10.2f %10.2f %5lu\n", classPair.first.c_str(), classExpectedGbs[classPair.first],
+           classPair.second.front(), classPair.second.back(), classPair.second.size());
+
+  bool const isHealthy = (numFailed == 0 && numSkipped == 0);
+  printf("\nHealth check %s: %d Tests run, %d skipped (time limit), %d Transfer(s) failed in %.2f seconds\n",
+         isHealthy ? "PASSED" : "FAILED", numRun, numSkipped, numFailed, elapsedSec());
+
+  // Without an expected file or floor, links are only compared against each other
+  bool const isRelativeOnly = (ev.hcExpectedFile.empty() && ev.hcMinBw == 0);
+  if (isRelativeOnly)
+    printf("[WARN] Health check is relative only (links are compared to the median of their link class), so a uniformly\n"
+           "       degraded node passes.  Set HC_EXPECTED_FILE or HC_MIN_BW for an absolute check\n");
+
+  JsonObject summary;
+  summary.Add("numTests", numChecks).Add("numSkipped", numSkipped).Add("numFailed", numFailed)
+    .Add("elapsedSec", elapsedSec()).Add("relativeOnly", isRelativeOnly).Add("pass", isHealthy);
+  ResultsSink::Get().Write("healthcheck_summary", summary);
+  return isHealthy;
 }
 
-void RunScalingBenchmark(EnvVars const& ev, size_t N, int const exeIndex, int const maxSubExecs)
+void RunLatencyBenchmark(EnvVars const& ev, size_t const numBytes)
 {
-  ev.DisplayEnvVars();
+  ev.DisplayLatencyEnvVars();
+
+  if (ev.numIterations <= 0)
+  {
+    printf("[ERROR] Latency preset requires NUM_ITERATIONS to be set to a positive number\n");
+    exit(1);
+  }
 
-  // Collect the number of available CPUs/GPUs on this machine
   int const numCpus    = ev.numCpuDevices;
   int const numGpus    = ev.numGpuDevices;
   int const numDevices = numCpus + numGpus;
@@ -1802,172 +4883,509 @@ void RunScalingBenchmark(EnvVars const& ev, size_t N, int const exeIndex, int co
     for (int j = 0; j < numGpus; j++)
       if (i != j) EnablePeerAccess(i, j);
 
-  char separator = (ev.outputToCsv ? ',' : ' ');
-
-  std::vector<Transfer> transfers(1);
-  transfers[0].numBytes = N * sizeof(float);
-  transfers[0].numSrcs  = 1;
-  transfers[0].numDsts  = 1;
-  transfers[0].exeType  = EXE_GPU_GFX;
-  transfers[0].exeIndex = exeIndex;
-  transfers[0].srcType.resize(1, MEM_GPU);
-  transfers[0].dstType.resize(1, MEM_GPU);
-  transfers[0].srcIndex.resize(1);
-  transfers[0].dstIndex.resize(1);
+  // Flags (and kernel results) must be coherent while kernels are running
+#if defined(__NVCC__)
+  MemType const hostFlagType = MEM_CPU;
+  MemType const gpuFlagType  = MEM_GPU;
+#else
+  MemType const hostFlagType = MEM_CPU_FINE;
+  MemType const gpuFlagType  = MEM_GPU_FINE;
+#endif
+  int64_t* results;
+  AcquireMemory(ev, hostFlagType, RemappedIndex(0, true), 2 * sizeof(int64_t), (void**)&results);
 
-  printf("GPU-GFX Scaling benchmark:\n");
-  printf("==========================\n");
-  printf("- Copying %lu bytes from GPU %d to other devices\n", transfers[0].numBytes, exeIndex);
-  printf("- All numbers reported as GB/sec\n\n");
+  // CPU sides run on the first (core-pinned) worker of the persistent CPU thread pool of their NUMA node, so that
+  // no threads are created while iterations are being measured
+  auto cpuWorkers = [&](int const cpuIndex) -> CpuThreadPool&
+  {
+    return GetCpuThreadPool(ev, RemappedIndex(cpuIndex, true));
+  };
 
-  printf("NumCUs");
-  for (int i = 0; i < numDevices; i++)
-    printf("%c  %s%02d     ", separator, i < numCpus ? "CPU" : "GPU", i < numCpus ? i : i - numCpus);
-  printf("\n");
+  auto gpuCyclesToMsec = [&](int const gpuIndex, int64_t const cycles)
+  {
+    return cycles / (double)ev.wallClockPerDeviceMhz[RemappedIndex(gpuIndex, false)];
+  };
 
-  std::vector<std::pair<double, int>> bestResult(numDevices);
-  for (int numSubExec = 1; numSubExec <= maxSubExecs; numSubExec++)
+  auto deviceName = [&](int const device)
   {
-    transfers[0].numSubExecs = numSubExec;
-    printf("%4d  ", numSubExec);
+    char name[16];
+    sprintf(name, "%s%d", device < numCpus ? "C" : "G", device < numCpus ? device : device - numCpus);
+    return std::string(name);
+  };
 
+  // Matrices are displayed in the same layout as the peer-to-peer benchmark (N/A when not measured)
+  char const separator = ev.outputToCsv ? ',' : ' ';
+  auto printMatrix = [&](char const* corner, std::vector<std::vector<double>> const& values)
+  {
+    printf("%12s", corner);
+    if (ev.outputToCsv) printf(",");
     for (int i = 0; i < numDevices; i++)
     {
-      transfers[0].dstType[0]  = i < numCpus ? MEM_CPU : MEM_GPU;
-      transfers[0].dstIndex[0] = i < numCpus ? i : i - numCpus;
-
-      ExecuteTransfers(ev, 0, N, transfers, false);
-      double transferDurationMsec = transfers[0].transferTime / (1.0 * ev.numIterations);
-      double transferBandwidthGbs = (transfers[0].numBytesActual / 1.0E9) / transferDurationMsec * 1000.0f;
-      printf("%c%7.2f     ", separator, transferBandwidthGbs);
+      if (i == numCpus && i != 0) printf("   ");
+      printf("%7s %02d", i < numCpus ? "CPU" : "GPU", i < numCpus ? i : i - numCpus);
+      if (ev.outputToCsv) printf(",");
+    }
+    printf("\n");
 
-      if (transferBandwidthGbs > bestResult[i].first)
+    for (int row = 0; row < numDevices; row++)
+    {
+      if (row == numCpus && row != 0) printf("\n");
+      printf("%5s %02d %3s", row < numCpus ? "CPU" : "GPU", row < numCpus ? row : row - numCpus, "");
+      if (ev.outputToCsv) printf(",");
+      for (int col = 0; col < numDevices; col++)
       {
-        bestResult[i].first  = transferBandwidthGbs;
-        bestResult[i].second = numSubExec;
+        if (col == numCpus && col != 0) printf("   ");
+        if (values[row][col] < 0)
+          printf("%10s", "N/A");
+        else
+          printf("%10.2f", values[row][col]);
+        if (ev.outputToCsv) printf(",");
       }
+      printf("\n");
     }
     printf("\n");
-  }
+  };
 
-  printf(" Best ");
-  for (int i = 0; i < numDevices; i++)
+  auto writeRecord = [&](char const* mode, int const row, int const col, LatencyHistogram const& histogram,
+                         double const scale)
   {
-    printf("%c%7.2f(%3d)", separator, bestResult[i].first, bestResult[i].second);
-  }
-  printf("\n");
-}
+    JsonObject record;
+    record.Add("mode", mode).Add(!strcmp(mode, "pointer-chase") ? "mem" : "initiator", deviceName(row))
+      .Add(!strcmp(mode, "pointer-chase") ? "exe" : "responder", deviceName(col))
+      .Add("mean", histogram.Mean() * scale).Add("p50", histogram.Percentile(50.0) * scale)
+      .Add("p99", histogram.Percentile(99.0) * scale).Add("min", histogram.Min() * scale)
+      .Add("max", histogram.Max() * scale).Add("units", scale == 1.0E6 ? "ns" : "us");
+    ResultsSink::Get().Write("latency", record);
+  };
 
-void RunAllToAllBenchmark(EnvVars const& ev, size_t const numBytesPerTransfer, int const numSubExecs)
-{
-  ev.DisplayA2AEnvVars();
+  // Pointer-chase over every memory location, from every executor that can access it
+  if (ev.latencyMode != 2)
+  {
+    size_t const elemsPerSlot = ev.latencyStride / sizeof(uint32_t);
+    size_t const numSlots     = numBytes / ev.latencyStride;
+    if (numSlots < 2 || numBytes / sizeof(uint32_t) > UINT32_MAX)
+    {
+      printf("[ERROR] Pointer-chase requires between 2 x LATENCY_STRIDE and 16GB of memory (N = %lu)\n", numBytes);
+      exit(1);
+    }
 
-  // Collect the number of GPU devices to use
-  int const numGpus = ev.numGpuDevices;
+    // The chain visits every slot once in random order (starting at slot 0) so that prefetching can not hide latency
+    std::vector<size_t> order(numSlots);
+    for (size_t i = 0; i < numSlots; i++) order[i] = i;
+    std::shuffle(order.begin() + 1, order.end(), *ev.generator);
+    std::vector<uint32_t> chain(numSlots * elemsPerSlot, 0);
+    for (size_t i = 0; i < numSlots; i++)
+      chain[order[i] * elemsPerSlot] = order[(i + 1) % numSlots] * elemsPerSlot;
+    size_t const chainBytes = chain.size() * sizeof(uint32_t);
+
+    std::vector<std::vector<double>> latencyNs(numDevices, std::vector<double>(numDevices, -1.0));
+    for (int mem = 0; mem < numDevices; mem++)
+    {
+      bool    const isCpuMem = (mem < numCpus);
+      int     const memIndex = isCpuMem ? mem : mem - numCpus;
+      MemType const memType  = isCpuMem ? (ev.useFineGrain ? MEM_CPU_FINE : MEM_CPU)
+                                        : (ev.useFineGrain ? MEM_GPU_FINE : MEM_GPU);
+      uint32_t* chainPtr;
+      AcquireMemory(ev, memType, RemappedIndex(memIndex, isCpuMem), chainBytes, (void**)&chainPtr);
+      if (isCpuMem)
+        memcpy(chainPtr, chain.data(), chainBytes);
+      else
+        HIP_CALL(hipMemcpy(chainPtr, chain.data(), chainBytes, hipMemcpyHostToDevice));
 
-  // Enable peer to peer for each GPU
-  for (int i = 0; i < numGpus; i++)
-    for (int j = 0; j < numGpus; j++)
-      if (i != j) EnablePeerAccess(i, j);
+      for (int exe = 0; exe < numDevices; exe++)
+      {
+        // CPU executors only chase host memory
+        bool const isCpuExe = (exe < numCpus);
+        int  const exeIndex = isCpuExe ? exe : exe - numCpus;
+        if (isCpuExe && (!isCpuMem || ev.numCpusPerNuma[exeIndex] == 0)) continue;
 
-  char separator = (ev.outputToCsv ? ',' : ' ');
+        LatencyHistogram histogram;
+        for (int iteration = -ev.numWarmups; iteration < ev.numIterations; iteration++)
+        {
+          double deltaMsec;
+          if (isCpuExe)
+          {
+            CpuThreadPool& threadPool = cpuWorkers(exeIndex);
+            threadPool.Launch(0, [&]()
+            {
+              volatile uint32_t const* ptr = chainPtr;
+              uint32_t idx = 0;
+              auto const cpuStart = std::chrono::high_resolution_clock::now();
+              for (int i = 0; i < ev.latencySteps; i++)
+                idx = ptr[idx];
+              auto const cpuDelta = std::chrono::high_resolution_clock::now() - cpuStart;
+              deltaMsec  = std::chrono::duration_cast<std::chrono::duration<double>>(cpuDelta).count() * 1000.0;
+              results[1] = idx;
+            });
+            threadPool.Wait(0);
+          }
+          else
+          {
+            HIP_CALL(hipSetDevice(RemappedIndex(exeIndex, false)));
+            PointerChaseKernel<<<1, 1>>>(chainPtr, ev.latencySteps, results);
+            HIP_CALL(hipDeviceSynchronize());
+            deltaMsec = gpuCyclesToMsec(exeIndex, results[0]);
+          }
+          if (iteration >= 0) histogram.Add(deltaMsec / ev.latencySteps);
+        }
+        latencyNs[mem][exe] = histogram.Mean() * 1.0E6;
+        writeRecord("pointer-chase", mem, exe, histogram, 1.0E6);
+      }
+      ReleaseMemory(ev, memType, chainPtr, chainBytes);
+    }
 
-  Transfer transfer;
-  transfer.numBytes    = numBytesPerTransfer;
-  transfer.numSubExecs = numSubExecs;
-  transfer.numSrcs     = 1;
-  transfer.numDsts     = 1;
-  transfer.exeType     = EXE_GPU_GFX;
-  transfer.srcType.resize(1, ev.useFineGrain ? MEM_GPU_FINE : MEM_GPU);
-  transfer.dstType.resize(1, ev.useFineGrain ? MEM_GPU_FINE : MEM_GPU);
-  transfer.srcIndex.resize(1);
-  transfer.dstIndex.resize(1);
+    printf("Pointer-chase load latency (ns) [%d dependent loads, %d-byte stride over %lu bytes of %s-grained memory]\n",
+           ev.latencySteps, ev.latencyStride, chainBytes, ev.useFineGrain ? "fine" : "coarse");
+    printMatrix("MEM\\EXE", latencyNs);
+  }
 
-  std::vector<Transfer> transfers;
-  for (int i = 0; i < numGpus; i++)
+  // Flag ping-pong between every pair of executors
+  if (ev.latencyMode != 1)
   {
-    transfer.srcIndex[0] = i;
-    for (int j = 0; j < numGpus; j++)
+    // Each flag is local to the executor polling it, except that a GPU polling for a CPU uses host memory on the
+    // CPU's NUMA node, as CPUs can not write to GPU memory directly
+    size_t const flagBytes = 256;
+    auto allocateFlag = [&](int const poller, int const writer, MemType& memType)
     {
-      transfer.dstIndex[0] = j;
-      transfer.exeIndex    = (ev.useRemoteRead ? j : i);
+      int const hostDevice = (poller < numCpus ? poller : writer < numCpus ? writer : -1);
+      memType = (hostDevice >= 0 ? hostFlagType : gpuFlagType);
+      uint32_t* flag;
+      AcquireMemory(ev, memType, hostDevice >= 0 ? RemappedIndex(hostDevice, true) : RemappedIndex(poller - numCpus, false),
+                    flagBytes, (void**)&flag);
+      if (IsCpuType(memType))
+        memset(flag, 0, flagBytes);
+      else
+        HIP_CALL(hipMemset(flag, 0, flagBytes));
+      return flag;
+    };
 
-      if (ev.a2aDirect)
+    std::vector<std::vector<double>> roundTripUs(numDevices, std::vector<double>(numDevices, -1.0));
+    for (int a = 0; a < numDevices; a++)
+    {
+      for (int b = 0; b < numDevices; b++)
       {
-#if !defined(__NVCC__)
-        if (i == j) continue;
+        if (a == b) continue;
+        if (a < numCpus && ev.numCpusPerNuma[a] == 0) continue;
+        if (b < numCpus && ev.numCpusPerNuma[b] == 0) continue;
 
-        uint32_t linkType, hopCount;
-        HIP_CALL(hipExtGetLinkTypeAndHopCount(RemappedIndex(i, false),
-                                              RemappedIndex(j, false),
-                                              &linkType, &hopCount));
-        if (hopCount != 1) continue;
-#endif
+        MemType memTypeA, memTypeB;
+        uint32_t* flagA = allocateFlag(a, b, memTypeA);
+        uint32_t* flagB = allocateFlag(b, a, memTypeB);
+        HIP_CALL(hipDeviceSynchronize());
+
+        // Round trip numbers keep counting up across iterations so that flags never need to be reset
+        uint32_t base = 0;
+        LatencyHistogram histogram;
+        for (int iteration = -ev.numWarmups; iteration < ev.numIterations; iteration++)
+        {
+          double deltaMsec = 0.0;
+          std::vector<CpuThreadPool*> cpuThreadPools;
+
+          // Start the responder (b) first, then the initiator (a)
+          for (int side = 1; side >= 0; side--)
+          {
+            int       const device      = (side == 0 ? a : b);
+            uint32_t* const localFlag   = (side == 0 ? flagA : flagB);
+            uint32_t* const remoteFlag  = (side == 0 ? flagB : flagA);
+            bool      const isInitiator = (side == 0);
+            if (device < numCpus)
+            {
+              int const numRoundTrips = ev.latencyRoundTrips;
+              cpuThreadPools.push_back(&cpuWorkers(device));
+              cpuThreadPools.back()->Launch(0, [localFlag, remoteFlag, base, numRoundTrips, isInitiator, &deltaMsec]()
+              {
+                volatile uint32_t* local  = localFlag;
+                volatile uint32_t* remote = remoteFlag;
+                auto const cpuStart = std::chrono::high_resolution_clock::now();
+                for (uint32_t i = base + 1; i <= base + numRoundTrips; i++)
+                {
+                  if (isInitiator)
+                  {
+                    *remote = i;
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    while (*local != i);
+                  }
+                  else
+                  {
+                    while (*local != i);
+                    *remote = i;
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                  }
+                }
+                auto const cpuDelta = std::chrono::high_resolution_clock::now() - cpuStart;
+                if (isInitiator)
+                  deltaMsec = std::chrono::duration_cast<std::chrono::duration<double>>(cpuDelta).count() * 1000.0;
+              });
+            }
+            else
+            {
+              HIP_CALL(hipSetDevice(RemappedIndex(device - numCpus, false)));
+              PingPongKernel<<<1, 1>>>(localFlag, remoteFlag, base, ev.latencyRoundTrips, isInitiator, results);
+            }
+          }
+
+          for (CpuThreadPool* threadPool : cpuThreadPools)
+            threadPool->Wait(0);
+          for (int device : {a, b})
+          {
+            if (device < numCpus) continue;
+            HIP_CALL(hipSetDevice(RemappedIndex(device - numCpus, false)));
+            HIP_CALL(hipDeviceSynchronize());
+          }
+          if (a >= numCpus) deltaMsec = gpuCyclesToMsec(a - numCpus, results[0]);
+
+          base += ev.latencyRoundTrips;
+          if (iteration >= 0) histogram.Add(deltaMsec / ev.latencyRoundTrips);
+        }
+        roundTripUs[a][b] = histogram.Mean() * 1.0E3;
+        writeRecord("ping-pong", a, b, histogram, 1.0E3);
+
+        ReleaseMemory(ev, memTypeA, flagA, flagBytes);
+        ReleaseMemory(ev, memTypeB, flagB, flagBytes);
       }
-      transfers.push_back(transfer);
     }
+
+    printf("Flag ping-pong round-trip latency (us) [%d round trips, flags in fine-grained memory]\n",
+           ev.latencyRoundTrips);
+    printMatrix("INIT\\RESP", roundTripUs);
   }
 
-  printf("GPU-GFX All-To-All benchmark:\n");
-  printf("==========================\n");
-  printf("- Copying %lu bytes between %s pairs of GPUs using %d CUs (%lu Transfers)\n",
-         numBytesPerTransfer, ev.a2aDirect ? "directly connected" : "all", numSubExecs, transfers.size());
-  if (transfers.size() == 0) return;
+  ReleaseMemory(ev, hostFlagType, results, 2 * sizeof(int64_t));
+}
 
-  double totalBandwidthCpu = 0;
-  ExecuteTransfers(ev, 0, numBytesPerTransfer / sizeof(float), transfers, true, &totalBandwidthCpu);
+FILE* OpenSampleFile(EnvVars const& ev)
+{
+  // Sampling windows of all Tests are collected into the same CSV file.  The first Test writing to a file starts it
+  // with a header, and later Tests append to it
+  static std::set<std::string> startedFiles;
+  static std::mutex            startedFilesMutex;
+  if (ev.sampleFile.empty()) return NULL;
+
+  std::lock_guard<std::mutex> lock(startedFilesMutex);
+  bool const isStarted = startedFiles.count(ev.sampleFile);
+  FILE* sampleFp = fopen(ev.sampleFile.c_str(), isStarted ? "a" : "w");
+  if (!sampleFp)
+  {
+    RunError("Unable to open sample file [%s] for writing", ev.sampleFile.c_str());
+  }
+  if (!isStarted)
+  {
+    fprintf(sampleFp, "Test#,Window#,Start(s),Stop(s),Transfer#,BW(GB/s),Iterations,Clock(MHz),Power(W)\n");
+    startedFiles.insert(ev.sampleFile);
+  }
+  return sampleFp;
+}
 
-  printf("\nSummary:\n");
-  printf("==========================================================\n");
-  printf("SRC\\DST");
-  for (int dst = 0; dst < numGpus; dst++)
-    printf("%cGPU %02d   ", separator, dst);
-  printf("   %cSTotal\n", separator);
+void ReportSampleWindow(EnvVars const& ev, FILE* sampleFp, int const testNum, int const windowIdx,
+                        double const startSec, double const stopSec, size_t const numIterations,
+                        std::map<int, Transfer*> const& transferList,
+                        std::map<int, double>& windowStartTimes, bool const verbose)
+{
+  for (auto const& transferPair : transferList)
+  {
+    Transfer const* transfer = transferPair.second;
+    double const windowTimeMsec = transfer->transferTime - windowStartTimes[transferPair.first];
+    double const bandwidthGbs   = (transfer->numBytesActual * numIterations / 1.0E9) / windowTimeMsec * 1000.0;
+
+    // GPU clock / power are only sampled for GPU executors
+    bool const hasGpuStats = ev.sampleGpuStats && IsGpuType(transfer->exeType);
+    int    clockMhz = -1;
+    double powerW   = -1.0;
+    char   gpuStats[64] = ",";
+    if (hasGpuStats)
+    {
+      GetGpuClockAndPower(RemappedIndex(transfer->exeIndex, false), clockMhz, powerW);
+      sprintf(gpuStats, "%d,%.1f", clockMhz, powerW);
+    }
 
-  std::map<std::pair<int, int>, int> reIndex;
-  for (int i = 0; i < transfers.size(); i++)
+    if (verbose)
+    {
+      if (ev.outputToCsv)
+        printf("Window,%d,%d,%.3f,%.3f,%d,%.3f,%lu,%s\n", testNum, windowIdx, startSec, stopSec,
+               transfer->transferIndex, bandwidthGbs, numIterations, gpuStats);
+      else
+      {
+        printf(" Window %04d      | %8.3f - %8.3f s | Transfer %02d | %7.3f GB/s | %6lu iterations",
+               windowIdx, startSec, stopSec, transfer->transferIndex, bandwidthGbs, numIterations);
+        if (hasGpuStats)
+          printf(" | %5d MHz | %6.1f W", clockMhz, powerW);
+        printf("\n");
+      }
+    }
+    if (sampleFp)
+    {
+      fprintf(sampleFp, "%d,%d,%.3f,%.3f,%d,%.3f,%lu,%s\n", testNum, windowIdx, startSec, stopSec,
+              transfer->transferIndex, bandwidthGbs, numIterations, gpuStats);
+      fflush(sampleFp);
+    }
+  }
+}
+
+void GetGpuClockAndPower(int const deviceIdx, int& clockMhz, double& powerW)
+{
+  clockMhz = -1;
+  powerW   = -1.0;
+#if !defined(__NVCC__)
+  // Current shader clock and power are exposed through the hwmon entries of the GPU's PCIe device
+  char pciBusId[20];
+  if (hipDeviceGetPCIBusId(pciBusId, 20, deviceIdx) != hipSuccess) return;
+  for (char* c = pciBusId; *c; c++) *c = tolower(*c);
+
+  std::string const hwmonDir = std::string("/sys/bus/pci/devices/") + pciBusId + "/hwmon";
+  DIR* dir = opendir(hwmonDir.c_str());
+  if (!dir) return;
+
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != NULL)
+  {
+    if (strncmp(entry->d_name, "hwmon", 5)) continue;
+    std::string const path = hwmonDir + "/" + entry->d_name + "/";
+    unsigned long long value;
+    FILE* fp;
+
+    if (clockMhz < 0 && (fp = fopen((path + "freq1_input").c_str(), "r")))
+    {
+      if (fscanf(fp, "%llu", &value) == 1) clockMhz = value / 1000000;
+      fclose(fp);
+    }
+    for (char const* powerFile : {"power1_average", "power1_input"})
+    {
+      if (powerW < 0 && (fp = fopen((path + powerFile).c_str(), "r")))
+      {
+        if (fscanf(fp, "%llu", &value) == 1) powerW = value / 1.0E6;
+        fclose(fp);
+      }
+    }
+  }
+  closedir(dir);
+#endif
+}
+
+void StartBackgroundLoad(EnvVars const& ev, int const deviceIdx, BackgroundLoad& load)
+{
+  load.deviceIdx = deviceIdx;
+  load.srcMem    = NULL;
+  load.dstMem    = NULL;
+#if defined(__NVCC__)
+  load.hostMemType = MEM_CPU;
+#else
+  load.hostMemType = MEM_CPU_FINE;
+#endif
+
+  // Default to one threadblock per CU that the background load is allowed to use
+  int numDeviceCUs = 0;
+  HIP_CALL(hipDeviceGetAttribute(&numDeviceCUs, hipDeviceAttributeMultiprocessorCount, deviceIdx));
+  load.numBlocks = ev.bgNumBlocks;
+  if (load.numBlocks == 0)
   {
-    Transfer const& t = transfers[i];
-    reIndex[std::make_pair(t.srcIndex[0], t.dstIndex[0])] = i;
+    if (ev.bgCuMask.empty())
+      load.numBlocks = numDeviceCUs;
+    else
+    {
+      for (int i = 0; i < numDeviceCUs && i / 32 < ev.bgCuMask.size(); i++)
+        if (ev.bgCuMask[i / 32] & (1 << (i % 32))) load.numBlocks++;
+    }
+    if (load.numBlocks == 0)
+    {
+      InputError("BG_CU_MASK does not enable any of the %d CUs of GPU device %d", numDeviceCUs, deviceIdx);
+    }
   }
 
-  double totalBandwidthGpu = 0.0;
-  std::vector<double> colTotalBandwidth(numGpus+1, 0.0);
-  for (int src = 0; src < numGpus; src++)
+  // Allocate everything before launching, as allocating GPU memory synchronizes the device
+  int const hostNuma = std::max(GetClosestNumaNode(deviceIdx), 0);
+  AllocateMemory(ev, load.hostMemType, hostNuma, sizeof(int), (void**)&load.stopFlag);
+  AllocateMemory(ev, load.hostMemType, hostNuma, load.numBlocks * sizeof(BackgroundResult), (void**)&load.results);
+  *(volatile int*)load.stopFlag = 0;
+
+  load.numPacksPerBlock = ev.bgBytes / sizeof(float4) / load.numBlocks;
+  if (ev.bgLoad == 2)
   {
-    double rowTotalBandwidth = 0;
-    printf("GPU %02d", src);
-    for (int dst = 0; dst < numGpus; dst++)
+    if (load.numPacksPerBlock == 0)
     {
-      if (reIndex.count(std::make_pair(src, dst)))
-      {
-        Transfer const& transfer = transfers[reIndex[std::make_pair(src,dst)]];
-        double transferDurationMsec = transfer.transferTime / (1.0 * ev.numIterations);
-        double transferBandwidthGbs = (transfer.numBytesActual / 1.0E9) / transferDurationMsec * 1000.0f;
-        colTotalBandwidth[dst] += transferBandwidthGbs;
-        rowTotalBandwidth += transferBandwidthGbs;
-        totalBandwidthGpu += transferBandwidthGbs;
-        printf("%c%7.2f  ", separator, transferBandwidthGbs);
-      }
-      else
-      {
-        printf("%c%7s  ", separator, "N/A");
-      }
+      InputError("BG_BYTES (%d) is too small to split across %d background threadblocks", ev.bgBytes, load.numBlocks);
     }
-    printf("   %c%7.2f\n", separator, rowTotalBandwidth);
-    colTotalBandwidth[numGpus] += rowTotalBandwidth;
+    size_t const numBytes = load.numPacksPerBlock * load.numBlocks * sizeof(float4);
+    AllocateMemory(ev, MEM_GPU, deviceIdx, numBytes, (void**)&load.srcMem);
+    AllocateMemory(ev, MEM_GPU, deviceIdx, numBytes, (void**)&load.dstMem);
   }
-  printf("\nRTotal");
-  for (int dst = 0; dst < numGpus; dst++)
+
+  // Without BG_CU_MASK, the background stream does not synchronize with the null stream.  Streams created with a CU
+  // mask are always blocking, so null-stream work on this device would wait on the background kernel, which only
+  // exits via the host flag.  Null-stream work (e.g. GPU allocation) is therefore not allowed on the device until the
+  // load is stopped, and validation instead synchronizes on its own non-blocking stream (see GetValidationStream)
+  HIP_CALL(hipSetDevice(deviceIdx));
+  if (ev.bgCuMask.size())
   {
-    printf("%c%7.2f  ", separator, colTotalBandwidth[dst]);
+#if !defined(__NVCC__)
+    HIP_CALL(hipExtStreamCreateWithCUMask(&load.stream, ev.bgCuMask.size(), ev.bgCuMask.data()));
+#endif
+  }
+  else
+  {
+    HIP_CALL(hipStreamCreateWithFlags(&load.stream, hipStreamNonBlocking));
   }
-  printf("   %c%7.2f\n", separator, colTotalBandwidth[numGpus]);
-  printf("\n");
 
-  printf("Average   bandwidth (GPU Timed): %7.2f GB/s\n", totalBandwidthGpu / transfers.size());
-  printf("Aggregate bandwidth (GPU Timed): %7.2f GB/s\n", totalBandwidthGpu);
-  printf("Aggregate bandwidth (CPU Timed): %7.2f GB/s\n", totalBandwidthCpu);
+  if (ev.bgLoad == 1)
+  {
+    BackgroundComputeKernel<<<load.numBlocks, ev.blockSize, 0, load.stream>>>(load.stopFlag, load.results);
+  }
+  else
+  {
+    BackgroundStreamKernel<<<load.numBlocks, ev.blockSize, 0, load.stream>>>(load.srcMem, load.dstMem, load.numPacksPerBlock,
+                                                                             load.stopFlag, load.results);
+  }
+  HIP_CALL(hipGetLastError());
+  GetBackgroundLoadDevices().insert(deviceIdx);
+}
+
+double StopBackgroundLoad(EnvVars const& ev, BackgroundLoad& load)
+{
+  // Each threadblock exits after finishing the pass during which it sees the stop flag
+  *(volatile int*)load.stopFlag = 1;
+  HIP_CALL(hipSetDevice(load.deviceIdx));
+  HIP_CALL(hipStreamSynchronize(load.stream));
+  HIP_CALL(hipStreamDestroy(load.stream));
+  GetBackgroundLoadDevices().erase(load.deviceIdx);
+
+  int64_t minStartCycle = std::numeric_limits<int64_t>::max();
+  int64_t maxStopCycle  = std::numeric_limits<int64_t>::min();
+  unsigned long long totalPasses = 0;
+  for (int i = 0; i < load.numBlocks; i++)
+  {
+    minStartCycle = std::min(minStartCycle, load.results[i].startCycle);
+    maxStopCycle  = std::max(maxStopCycle,  load.results[i].stopCycle);
+    totalPasses  += load.results[i].numPasses;
+  }
+
+  // Compute load reports TFLOP/s (2 FLOPs per FMA), memory load reports GB/s (bytes read + written)
+  double const durationMsec = (maxStopCycle - minStartCycle) / (double)ev.wallClockPerDeviceMhz[load.deviceIdx];
+  double const workPerPass  = (ev.bgLoad == 1 ? 2.0 * BG_FMA_PER_PASS * ev.blockSize
+                                              : 2.0 * load.numPacksPerBlock * sizeof(float4));
+  double const throughput   = totalPasses * workPerPass / durationMsec / (ev.bgLoad == 1 ? 1.0E9 : 1.0E6);
+
+  size_t const numBytes = load.numPacksPerBlock * load.numBlocks * sizeof(float4);
+  if (load.srcMem) DeallocateMemory(MEM_GPU, load.srcMem, numBytes);
+  if (load.dstMem) DeallocateMemory(MEM_GPU, load.dstMem, numBytes);
+  DeallocateMemory(load.hostMemType, load.stopFlag, sizeof(int));
+  DeallocateMemory(load.hostMemType, load.results, load.numBlocks * sizeof(BackgroundResult));
+  return throughput;
+}
+
+double GetSoloBackgroundThroughput(EnvVars const& ev, int const deviceIdx)
+{
+  // Cached per GPU and background load settings, so that this is only measured once per run
+  typedef std::tuple<int, int, int, int, int, std::vector<uint32_t>> SoloKey;
+  static std::map<SoloKey, double> soloThroughput;
+
+  SoloKey const key(deviceIdx, ev.bgLoad, ev.bgNumBlocks, ev.bgBytes, ev.blockSize, ev.bgCuMask);
+  auto it = soloThroughput.find(key);
+  if (it != soloThroughput.end()) return it->second;
+
+  int const soloDurationMsec = 200;
+  BackgroundLoad load;
+  StartBackgroundLoad(ev, deviceIdx, load);
+  std::this_thread::sleep_for(std::chrono::milliseconds(soloDurationMsec));
+  return soloThroughput[key] = StopBackgroundLoad(ev, load);
 }
 
 void Transfer::PrepareSubExecParams(EnvVars const& ev)
@@ -1984,6 +5402,7 @@ void Transfer::PrepareSubExecParams(EnvVars const& ev)
   int const maxSubExecToUse = std::min((size_t)(N + targetMultiple - 1) / targetMultiple, (size_t)this->numSubExecs);
   this->subExecParam.clear();
   this->subExecParam.resize(this->numSubExecs);
+  this->subExecIdx.clear();
 
   size_t assigned = 0;
   for (int i = 0; i < this->numSubExecs; ++i)
@@ -2021,52 +5440,188 @@ void Transfer::PrepareSubExecParams(EnvVars const& ev)
     assigned += p.N;
   }
 
+  // With the work-stealing kernel, every subExecutor covers the whole Transfer and claims chunks of it at runtime
+  // (the shared chunk counter is assigned once the executor's counters have been allocated)
+  this->numChunksPerSubExec.clear();
+  if (this->exeType == EXE_GPU_GFX && ev.gpuKernel == GPU_KERNEL_STEAL)
+  {
+    for (SubExecParam& p : this->subExecParam)
+    {
+      p.N = N;
+      for (int iSrc = 0; iSrc < this->numSrcs; ++iSrc)
+        p.src[iSrc] = this->srcMem[iSrc] + initOffset;
+      for (int iDst = 0; iDst < this->numDsts; ++iDst)
+        p.dst[iDst] = this->dstMem[iDst] + initOffset;
+      p.chunkSize    = ev.stealChunkBytes / sizeof(float);
+      p.chunkCounter = nullptr;
+      p.numStealers  = this->numSubExecs;
+    }
+    this->numChunksPerSubExec.resize(this->numSubExecs, 0);
+  }
+
   this->transferTime = 0.0;
+  this->numTimedIterations = 0;
+  this->numLoopPasses = 0;
+  this->latencyHistogram.Clear();
   this->perIterationTime.clear();
 }
 
-void Transfer::PrepareReference(EnvVars const& ev, std::vector<float>& buffer, int bufferIdx)
+// Fills elements [0, numElems) of a reference buffer of type T, split across all available CPU threads
+template <typename T, typename AccT>
+void PrepareTypedReference(EnvVars const& ev, int const numSrcs, float* buffer, size_t const numElems, int const bufferIdx)
+{
+  T*           const elems      = (T*)buffer;
+  float const* const pattern    = ev.fillPattern.data();
+  size_t       const patternLen = ev.fillPattern.size();
+
+  // Each element only depends on its own index, so the buffer can be split into independent chunks
+  size_t const minChunkElems = 1 << 20;
+  size_t const numThreads    = std::max((size_t)1, std::min((size_t)std::thread::hardware_concurrency(),
+                                                            RoundUp(numElems, minChunkElems) / minChunkElems));
+  size_t const chunkElems    = RoundUp(numElems, numThreads) / numThreads;
+
+  auto fillChunk = [=](size_t const start, size_t const stop)
+  {
+    for (size_t i = start; i < stop; ++i)
+      elems[i] = ExpectedTypedValue<T, AccT>(numSrcs, bufferIdx, i, pattern, patternLen);
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t t = 1; t < numThreads; ++t)
+    threads.push_back(std::thread(fillChunk, std::min(numElems, t * chunkElems), std::min(numElems, (t + 1) * chunkElems)));
+  fillChunk(0, std::min(numElems, chunkElems));
+  for (auto& thread : threads) thread.join();
+}
+
+std::shared_ptr<std::vector<float> const> Transfer::PrepareReference(EnvVars const& ev, int bufferIdx)
 {
-  size_t N = buffer.size();
-  if (bufferIdx >= 0)
+  // Reference buffers are cached across Tests, keyed by (#srcs reduced, buffer index) for destination / source buffers.
+  // Element values only depend on their index, so only the largest reference is kept, and smaller sizes use its prefix.
+  // The cache is shared by all threads of the process.  Callers hold a reference to the returned buffer, so it stays
+  // valid even if it is later dropped from the cache
+  static std::mutex cacheMutex;
+  static std::map<std::pair<int, int>, std::shared_ptr<std::vector<float>>> referenceCache;
+  static std::tuple<int, int, std::vector<float>> cacheSettings;
+  std::lock_guard<std::mutex> lock(cacheMutex);
+
+  // Cache is invalidated if the datatype, accumulation mode or fill pattern changes
+  std::tuple<int, int, std::vector<float>> const settings(ev.dataType, ev.nativeAccum, ev.fillPattern);
+  if (settings != cacheSettings)
   {
-    size_t patternLen = ev.fillPattern.size();
-    if (patternLen > 0)
-    {
-      for (size_t i = 0; i < N; ++i)
-        buffer[i] = ev.fillPattern[i % patternLen];
-    }
-    else
-    {
-      for (size_t i = 0; i < N; ++i)
-        buffer[i] = PrepSrcValue(bufferIdx, i);
-    }
+    referenceCache.clear();
+    cacheSettings = settings;
+  }
+
+  size_t const N = this->numBytesActual / sizeof(float);
+  std::pair<int, int> const key = std::make_pair(bufferIdx >= 0 ? 0 : this->numSrcs, bufferIdx);
+  std::shared_ptr<std::vector<float>>& cached = referenceCache[key];
+  if (cached && cached->size() >= N) return cached;
+
+  // Drop the other cached references if keeping them would exceed the cap
+  size_t cachedBytes = N * sizeof(float);
+  for (auto const& entry : referenceCache)
+    if (entry.first != key && entry.second) cachedBytes += entry.second->size() * sizeof(float);
+  if (cachedBytes > MAX_REFERENCE_CACHE_BYTES)
+  {
+    for (auto& entry : referenceCache)
+      if (entry.first != key) entry.second.reset();
   }
-  else // Destination buffer
+
+  // Replace the cached buffer with one that fits
+  cached.reset();
+  cached = std::make_shared<std::vector<float>>(N);
+
+  size_t const numElems = N * sizeof(float) / DataTypeSizes[ev.dataType];
+  bool   const native   = ev.nativeAccum;
+  float* const data     = cached->data();
+  switch (ev.dataType)
+  {
+  case DATA_FP32:
+    PrepareTypedReference<float, float>(ev, this->numSrcs, data, numElems, bufferIdx);
+    break;
+  case DATA_FP16:
+    if (native) PrepareTypedReference<Fp16Raw_t, Fp16Raw_t>(ev, this->numSrcs, data, numElems, bufferIdx);
+    else        PrepareTypedReference<Fp16Raw_t, float    >(ev, this->numSrcs, data, numElems, bufferIdx);
+    break;
+  case DATA_BF16:
+    if (native) PrepareTypedReference<Bf16Raw_t, Bf16Raw_t>(ev, this->numSrcs, data, numElems, bufferIdx);
+    else        PrepareTypedReference<Bf16Raw_t, float    >(ev, this->numSrcs, data, numElems, bufferIdx);
+    break;
+  case DATA_FP8:
+    if (native) PrepareTypedReference<Fp8Raw_t,  Fp8Raw_t >(ev, this->numSrcs, data, numElems, bufferIdx);
+    else        PrepareTypedReference<Fp8Raw_t,  float    >(ev, this->numSrcs, data, numElems, bufferIdx);
+    break;
+  case DATA_INT32:
+    PrepareTypedReference<int32_t, int32_t>(ev, this->numSrcs, data, numElems, bufferIdx);
+    break;
+  }
+  return cached;
+}
+
+template <typename T, typename AccT>
+size_t ValidateTypedOnGpu(EnvVars const& ev, float const* ptr, int const deviceIdx, int const numSrcs,
+                          int const bufferIdx, size_t const numBytes, size_t& firstMismatch)
+{
+  size_t const numElems   = numBytes / sizeof(T);
+  size_t const patternLen = ev.fillPattern.size();
+
+  // Scratch buffers are allocated once per device, and the fill pattern (if any) is only re-copied when it changes
+  hipStream_t const stream = GetValidationStream(deviceIdx);
+  MemPool& memPool = GetMemPool();
+  std::lock_guard<std::mutex> lock(memPool.mutex);
+  ValidationScratch& scratch = memPool.validation[deviceIdx];
+  if (!scratch.devResults)
+    HIP_CALL(hipMalloc((void**)&scratch.devResults, 2 * sizeof(unsigned long long)));
+  if (scratch.pattern != ev.fillPattern)
   {
-    if (this->numSrcs == 0)
+    if (scratch.devPattern) HIP_CALL(hipFree(scratch.devPattern));
+    scratch.devPattern = NULL;
+    if (patternLen)
     {
-      // Note: 0x75757575 = 13323083.0
-      memset(buffer.data(), MEMSET_CHAR, N * sizeof(float));
+      HIP_CALL(hipMalloc((void**)&scratch.devPattern, patternLen * sizeof(float)));
+      HIP_CALL(hipMemcpyAsync(scratch.devPattern, ev.fillPattern.data(), patternLen * sizeof(float),
+                              hipMemcpyHostToDevice, stream));
     }
-    else
-    {
-      PrepareReference(ev, buffer, 0);
+    scratch.pattern = ev.fillPattern;
+  }
 
-      if (this->numSrcs > 1)
-      {
-        std::vector<float> temp(N);
-        for (int srcIdx = 1; srcIdx < this->numSrcs; ++srcIdx)
-        {
-          PrepareReference(ev, temp, srcIdx);
-          for (int i = 0; i < N; ++i)
-          {
-            buffer[i] += temp[i];
-          }
-        }
-      }
-    }
+  unsigned long long results[2] = {0, ~0ULL};
+  HIP_CALL(hipMemcpyAsync(scratch.devResults, results, sizeof(results), hipMemcpyHostToDevice, stream));
+
+  int const numBlocks = std::max((size_t)1, std::min(RoundUp(numElems, ev.blockSize) / ev.blockSize, (size_t)4096));
+  ValidateBufferKernel<T, AccT><<<numBlocks, ev.blockSize, 0, stream>>>((T const*)ptr, numElems, numSrcs, bufferIdx,
+                                                                        scratch.devPattern, patternLen, scratch.devResults);
+  HIP_CALL(hipGetLastError());
+  HIP_CALL(hipMemcpyAsync(results, scratch.devResults, sizeof(results), hipMemcpyDeviceToHost, stream));
+  HIP_CALL(hipStreamSynchronize(stream));
+
+  firstMismatch = results[0] ? results[1] * sizeof(T) / sizeof(float) : 0;
+  return results[0];
+}
+
+size_t Transfer::ValidateOnGpu(EnvVars const& ev, float const* ptr, int const deviceIdx, int const bufferIdx,
+                               size_t& firstMismatch)
+{
+  HIP_CALL(hipSetDevice(deviceIdx));
+  bool   const native   = ev.nativeAccum;
+  size_t const numBytes = this->numBytesActual;
+  switch (ev.dataType)
+  {
+  case DATA_FP32:
+    return ValidateTypedOnGpu<float, float>(ev, ptr, deviceIdx, this->numSrcs, bufferIdx, numBytes, firstMismatch);
+  case DATA_FP16:
+    if (native) return ValidateTypedOnGpu<Fp16Raw_t, Fp16Raw_t>(ev, ptr, deviceIdx, this->numSrcs, bufferIdx, numBytes, firstMismatch);
+    else        return ValidateTypedOnGpu<Fp16Raw_t, float    >(ev, ptr, deviceIdx, this->numSrcs, bufferIdx, numBytes, firstMismatch);
+  case DATA_BF16:
+    if (native) return ValidateTypedOnGpu<Bf16Raw_t, Bf16Raw_t>(ev, ptr, deviceIdx, this->numSrcs, bufferIdx, numBytes, firstMismatch);
+    else        return ValidateTypedOnGpu<Bf16Raw_t, float    >(ev, ptr, deviceIdx, this->numSrcs, bufferIdx, numBytes, firstMismatch);
+  case DATA_FP8:
+    if (native) return ValidateTypedOnGpu<Fp8Raw_t,  Fp8Raw_t >(ev, ptr, deviceIdx, this->numSrcs, bufferIdx, numBytes, firstMismatch);
+    else        return ValidateTypedOnGpu<Fp8Raw_t,  float    >(ev, ptr, deviceIdx, this->numSrcs, bufferIdx, numBytes, firstMismatch);
+  case DATA_INT32:
+    return ValidateTypedOnGpu<int32_t, int32_t>(ev, ptr, deviceIdx, this->numSrcs, bufferIdx, numBytes, firstMismatch);
   }
+  return 0;
 }
 
 bool Transfer::PrepareSrc(EnvVars const& ev)
@@ -2075,44 +5630,88 @@ bool Transfer::PrepareSrc(EnvVars const& ev)
   size_t const N = this->numBytesActual / sizeof(float);
   int const initOffset = ev.byteOffset / sizeof(float);
 
-  std::vector<float> reference(N);
+  // Non-fp32 datatypes are compared bitwise
+  bool const bitwiseCompare = (ev.dataType != DATA_FP32);
+
+  std::shared_ptr<std::vector<float> const> referenceBuffer;
+  float const* reference = NULL;
   for (int srcIdx = 0; srcIdx < this->numSrcs; ++srcIdx)
   {
     float* srcPtr = this->srcMem[srcIdx] + initOffset;
-    PrepareReference(ev, reference, srcIdx);
+
+    // Managed memory first touched by the CPU is initialized and checked on the host so that its pages
+    // are not migrated to the GPU before the Transfer runs
+    bool const isGpuSrc = IsGpuType(this->srcType[srcIdx]) &&
+      !(this->srcType[srcIdx] == MEM_MANAGED && ev.managedFirstTouch);
+
+    // Host reference is only required when copying it to the source, or when validating on the host
+    bool const needReference = !isGpuSrc || !ev.usePrepSrcKernel || !ev.validateOnGpu;
+    if (needReference)
+    {
+      referenceBuffer = PrepareReference(ev, srcIdx);
+      reference       = referenceBuffer->data();
+    }
 
     // Initialize source memory array with reference pattern
-    if (IsGpuType(this->srcType[srcIdx]))
+    if (isGpuSrc)
     {
-      int const deviceIdx = RemappedIndex(this->srcIndex[srcIdx], false);
+      int const deviceIdx = this->SrcDevice(srcIdx);
+      hipStream_t const stream = GetValidationStream(deviceIdx);
       HIP_CALL(hipSetDevice(deviceIdx));
       if (ev.usePrepSrcKernel)
-        PrepSrcDataKernel<<<32, ev.blockSize>>>(srcPtr, N, srcIdx);
+      {
+        size_t const numElems = this->numBytesActual / DataTypeSizes[ev.dataType];
+        switch (ev.dataType)
+        {
+        case DATA_FP32:  PrepSrcDataKernel<<<32, ev.blockSize, 0, stream>>>(srcPtr, numElems, srcIdx); break;
+        case DATA_FP16:  PrepSrcDataKernel<<<32, ev.blockSize, 0, stream>>>((Fp16Raw_t*)srcPtr, numElems, srcIdx); break;
+        case DATA_BF16:  PrepSrcDataKernel<<<32, ev.blockSize, 0, stream>>>((Bf16Raw_t*)srcPtr, numElems, srcIdx); break;
+        case DATA_FP8:   PrepSrcDataKernel<<<32, ev.blockSize, 0, stream>>>((Fp8Raw_t*) srcPtr, numElems, srcIdx); break;
+        case DATA_INT32: PrepSrcDataKernel<<<32, ev.blockSize, 0, stream>>>((int32_t*)  srcPtr, numElems, srcIdx); break;
+        }
+      }
       else
-        HIP_CALL(hipMemcpy(srcPtr, reference.data(), this->numBytesActual, hipMemcpyDefault));
-      HIP_CALL(hipDeviceSynchronize());
+        HIP_CALL(hipMemcpyAsync(srcPtr, reference, this->numBytesActual, hipMemcpyDefault, stream));
+      HIP_CALL(hipStreamSynchronize(stream));
     }
-    else if (IsCpuType(this->srcType[srcIdx]))
+    else if (IsCpuType(this->srcType[srcIdx]) || this->srcType[srcIdx] == MEM_MANAGED)
     {
-      memcpy(srcPtr, reference.data(), this->numBytesActual);
+      memcpy(srcPtr, reference, this->numBytesActual);
     }
 
     // Perform check just to make sure that data has been copied properly
+    if (isGpuSrc && ev.validateOnGpu)
+    {
+      size_t firstMismatch;
+      size_t const numMismatches = ValidateOnGpu(ev, srcPtr, this->SrcDevice(srcIdx), srcIdx, firstMismatch);
+      if (numMismatches == 0) continue;
+      printf("\n[ERROR] GPU validation found %lu mismatching element(s) in source array %d (first at index %lu)\n",
+             numMismatches, srcIdx, firstMismatch);
+
+      // Fall back to host comparison to report details
+      if (!needReference)
+      {
+        referenceBuffer = PrepareReference(ev, srcIdx);
+        reference       = referenceBuffer->data();
+      }
+    }
+
     float* srcCheckPtr = srcPtr;
     std::vector<float> srcCopy(N);
-    if (IsGpuType(this->srcType[srcIdx]))
+    if (isGpuSrc)
     {
       if (!ev.validateDirect)
       {
-        HIP_CALL(hipMemcpy(srcCopy.data(), srcPtr, this->numBytesActual, hipMemcpyDefault));
-        HIP_CALL(hipDeviceSynchronize());
+        hipStream_t const stream = GetValidationStream(this->SrcDevice(srcIdx));
+        HIP_CALL(hipMemcpyAsync(srcCopy.data(), srcPtr, this->numBytesActual, hipMemcpyDefault, stream));
+        HIP_CALL(hipStreamSynchronize(stream));
         srcCheckPtr = srcCopy.data();
       }
     }
 
     for (size_t i = 0; i < N; ++i)
     {
-      if (reference[i] != srcCheckPtr[i])
+      if (bitwiseCompare ? (FloatToBits(reference[i]) != FloatToBits(srcCheckPtr[i])) : (reference[i] != srcCheckPtr[i]))
       {
         printf("\n[ERROR] Unexpected mismatch at index %lu of source array %d:\n", i, srcIdx);
 #if !defined(__NVCC__)
@@ -2129,7 +5728,7 @@ bool Transfer::PrepareSrc(EnvVars const& ev)
                ExeTypeStr[this->exeType], this->exeIndex,
                this->numSubExecs,
                this->DstToStr().c_str());
-        if (!ev.continueOnError)
+        if (!ev.continueOnError && !throwRunErrors)
           exit(1);
         return false;
       }
@@ -2138,18 +5737,41 @@ bool Transfer::PrepareSrc(EnvVars const& ev)
   return true;
 }
 
-void Transfer::ValidateDst(EnvVars const& ev)
+bool Transfer::ValidateDst(EnvVars const& ev)
 {
-  if (this->numDsts == 0) return;
+  if (this->numDsts == 0) return true;
+
   size_t const N = this->numBytesActual / sizeof(float);
   int const initOffset = ev.byteOffset / sizeof(float);
 
-  std::vector<float> reference(N);
-  PrepareReference(ev, reference, -1);
+  // Host reference is only prepared once a buffer needs to be checked on the host
+  std::shared_ptr<std::vector<float> const> referenceBuffer;
+  float const* reference = NULL;
+
+  // Non-fp32 datatypes are compared bitwise
+  bool const bitwiseCompare = (ev.dataType != DATA_FP32);
 
-  std::vector<float> hostBuffer(N);
+  bool isCorrect = true;
+  std::vector<float> hostBuffer;
   for (int dstIdx = 0; dstIdx < this->numDsts; ++dstIdx)
   {
+    if (IsGpuType(this->dstType[dstIdx]) && ev.validateOnGpu)
+    {
+      size_t firstMismatch;
+      int const deviceIdx = this->DstDevice(dstIdx);
+      size_t const numMismatches = ValidateOnGpu(ev, this->dstMem[dstIdx] + initOffset, deviceIdx, -1, firstMismatch);
+      if (numMismatches == 0) continue;
+      printf("\n[ERROR] GPU validation found %lu mismatching element(s) in destination array %d (first at index %lu)\n",
+             numMismatches, dstIdx, firstMismatch);
+      // Fall back to host comparison to report details
+    }
+
+    if (!reference)
+    {
+      referenceBuffer = PrepareReference(ev, -1);
+      reference       = referenceBuffer->data();
+    }
+
     float* output;
     if (IsCpuType(this->dstType[dstIdx]) || ev.validateDirect)
     {
@@ -2157,22 +5779,29 @@ void Transfer::ValidateDst(EnvVars const& ev)
     }
     else
     {
-      int const deviceIdx = RemappedIndex(this->dstIndex[dstIdx], false);
+      int const deviceIdx = this->DstDevice(dstIdx);
+      hipStream_t const stream = GetValidationStream(deviceIdx);
       HIP_CALL(hipSetDevice(deviceIdx));
-      HIP_CALL(hipMemcpy(hostBuffer.data(), this->dstMem[dstIdx] + initOffset, this->numBytesActual, hipMemcpyDefault));
-      HIP_CALL(hipDeviceSynchronize());
+      hostBuffer.resize(N);
+      HIP_CALL(hipMemcpyAsync(hostBuffer.data(), this->dstMem[dstIdx] + initOffset, this->numBytesActual,
+                              hipMemcpyDefault, stream));
+      HIP_CALL(hipStreamSynchronize(stream));
       output = hostBuffer.data();
     }
 
     for (size_t i = 0; i < N; ++i)
     {
-      if (reference[i] != output[i])
+      if (bitwiseCompare ? (FloatToBits(reference[i]) != FloatToBits(output[i])) : (reference[i] != output[i]))
       {
         printf("\n[ERROR] Unexpected mismatch at index %lu of destination array %d:\n", i, dstIdx);
+        int currDevice;
+        HIP_CALL(hipGetDevice(&currDevice));
+        hipStream_t const stream = GetValidationStream(currDevice);
         for (int srcIdx = 0; srcIdx < this->numSrcs; ++srcIdx)
         {
           float srcVal;
-          HIP_CALL(hipMemcpy(&srcVal, this->srcMem[srcIdx] + initOffset + i, sizeof(float), hipMemcpyDefault));
+          HIP_CALL(hipMemcpyAsync(&srcVal, this->srcMem[srcIdx] + initOffset + i, sizeof(float), hipMemcpyDefault, stream));
+          HIP_CALL(hipStreamSynchronize(stream));
 #if !defined(__NVCC__)
           float val = this->srcMem[srcIdx][initOffset + i];
           printf("[ERROR] SRC %02dD  value: %10.5f [%08X] Direct: %10.5f [%08X]\n",
@@ -2195,13 +5824,34 @@ void Transfer::ValidateDst(EnvVars const& ev)
                ExeTypeStr[this->exeType], this->exeIndex,
                this->numSubExecs,
                this->DstToStr().c_str());
-        if (!ev.continueOnError)
-          exit(1);
-        else
-          break;
+
+        // Exiting is left to the caller so that all ranks can agree on the failure first
+        isCorrect = false;
+        break;
       }
     }
+    if (!isCorrect && !ev.continueOnError) break;
   }
+  return isCorrect;
+}
+
+bool CheckDstCorrect(EnvVars const& ev, bool const isDstCorrect)
+{
+  // Ranks agree on the result first so that none of them is left waiting in a collective
+  bool const isAllCorrect = MpAll(isDstCorrect);
+  if (!isAllCorrect && !ev.continueOnError && !throwRunErrors)
+    exit(1);
+  return isAllCorrect;
+}
+
+int Transfer::SrcDevice(int i) const
+{
+  return RemappedIndex(SrcRank(i) == exeRank ? srcIndex[i] : exeIndex, false);
+}
+
+int Transfer::DstDevice(int i) const
+{
+  return RemappedIndex(DstRank(i) == exeRank ? dstIndex[i] : exeIndex, false);
 }
 
 std::string Transfer::SrcToStr() const
@@ -2209,7 +5859,10 @@ std::string Transfer::SrcToStr() const
   if (numSrcs == 0) return "N";
   std::stringstream ss;
   for (int i = 0; i < numSrcs; ++i)
+  {
     ss << MemTypeStr[srcType[i]] << srcIndex[i];
+    if (SrcRank(i)) ss << "@" << SrcRank(i);
+  }
   return ss.str();
 }
 
@@ -2218,7 +5871,10 @@ std::string Transfer::DstToStr() const
   if (numDsts == 0) return "N";
   std::stringstream ss;
   for (int i = 0; i < numDsts; ++i)
+  {
     ss << MemTypeStr[dstType[i]] << dstIndex[i];
+    if (DstRank(i)) ss << "@" << DstRank(i);
+  }
   return ss.str();
 }
 
@@ -2379,7 +6035,7 @@ void RunSweepPreset(EnvVars const& ev, size_t const numBytesPerTransfer, int con
   }
 
   int const numPossible = (int)possibleTransfers.size();
-  int maxParallelTransfers = (ev.sweepMax == 0 ? numPossible : ev.sweepMax);
+  int maxParallelTransfers = (ev.sweepMax == 0 ? numPossible : std::min(ev.sweepMax, numPossible));
 
   if (ev.sweepMin > numPossible)
   {
@@ -2387,6 +6043,117 @@ void RunSweepPreset(EnvVars const& ev, size_t const numBytesPerTransfer, int con
     return;
   }
 
+  // Transfers that share an executor, or the link between their executor and a remote memory location, are
+  // likely to contend with each other.  Collect the resources each possible Transfer touches
+  int const numDevs     = ev.numGpuDevices + ev.numCpuDevices;
+  int const numExeTypes = strlen(ExeTypeStr);
+  std::vector<std::vector<int>> resources(numPossible);
+  for (int i = 0; i < numPossible; i++)
+  {
+    TransferInfo const& t = possibleTransfers[i];
+    int const exeDev = IsGpuType(t.exeType) ? t.exeIndex : ev.numGpuDevices + t.exeIndex;
+    int const srcDev = IsGpuType(t.srcType) ? t.srcIndex : ev.numGpuDevices + t.srcIndex;
+    int const dstDev = IsGpuType(t.dstType) ? t.dstIndex : ev.numGpuDevices + t.dstIndex;
+
+    resources[i].push_back(t.exeType * numDevs + exeDev);
+    for (int memDev : {srcDev, dstDev})
+      if (memDev != exeDev)
+        resources[i].push_back((numExeTypes + std::min(exeDev, memDev)) * numDevs + std::max(exeDev, memDev));
+  }
+
+  // Contention score of a combination is the number of pairs of Transfers that share a resource
+  auto contentionScore = [&](int const* combo, int const comboSize)
+  {
+    std::map<int, int> counts;
+    for (int i = 0; i < comboSize; i++)
+      for (int r : resources[combo[i]])
+        counts[r]++;
+    size_t score = 0;
+    for (auto const& count : counts)
+      score += count.second * (count.second - 1) / 2;
+    return score;
+  };
+
+  // Combinations are identified by their sorted indices into possibleTransfers (ignoring sizes)
+  auto comboKey = [](std::vector<int> const& combo)
+  {
+    std::string key;
+    for (int i = 0; i < combo.size(); i++)
+      key += (i ? "," : "") + std::to_string(combo[i]);
+    return key;
+  };
+
+  // Resume from a checkpoint of previously completed combinations.  The header holds every setting that changes
+  // which combinations exist or what each of them measures.  The order in which combinations are visited
+  // (SWEEP_PRIORITIZE, SWEEP_SEED) may differ, as completed combinations are skipped wherever they come up
+  std::set<std::string> completed;
+  char checkpointHeader[MAX_LINE_LEN];
+  sprintf(checkpointHeader, "# TransferBench sweep checkpoint: %s SRC=%s EXE=%s DST=%s MIN=%d MAX=%d XGMI=%d:%d POSSIBLE=%d "
+          "BYTES=%lu RAND_BYTES=%d SUBEXECS=%d:%d\n",
+          isRandom ? "rsweep" : "sweep", ev.sweepSrc.c_str(), ev.sweepExe.c_str(), ev.sweepDst.c_str(),
+          ev.sweepMin, maxParallelTransfers, ev.sweepXgmiMin, ev.sweepXgmiMax, numPossible,
+          numBytesPerTransfer, ev.sweepRandBytes, numGpuSubExecs, numCpuSubExecs);
+  FILE* checkpointFp = NULL;
+  if (!ev.sweepCheckpoint.empty())
+  {
+    FILE* resumeFp = fopen(ev.sweepCheckpoint.c_str(), "r");
+    bool const isResuming = (resumeFp != NULL);
+    if (isResuming)
+    {
+      char line[MAX_LINE_LEN];
+      if (!fgets(line, MAX_LINE_LEN, resumeFp) || strcmp(line, checkpointHeader))
+      {
+        printf("[ERROR] Sweep checkpoint %s was created with a different sweep configuration\n", ev.sweepCheckpoint.c_str());
+        exit(1);
+      }
+      while (fgets(line, MAX_LINE_LEN, resumeFp))
+      {
+        std::vector<int> combo;
+        for (char* token = strtok(line, ",\n"); token; token = strtok(NULL, ",\n"))
+          combo.push_back(atoi(token));
+        if (!combo.empty()) completed.insert(comboKey(combo));
+      }
+      fclose(resumeFp);
+      printf("Resuming sweep from %s (%lu tests already completed)\n", ev.sweepCheckpoint.c_str(), completed.size());
+    }
+
+    checkpointFp = fopen(ev.sweepCheckpoint.c_str(), "a");
+    if (!checkpointFp)
+    {
+      printf("[ERROR] Unable to open sweep checkpoint %s.  Check permissions\n", ev.sweepCheckpoint.c_str());
+      exit(1);
+    }
+    if (!isResuming) fprintf(checkpointFp, "%s", checkpointHeader);
+  }
+
+  // Pre-allocate every buffer that the sweep may need so that memory is only allocated once (only useful when the
+  // buffers are kept in the pool, which the sweep presets force)
+  if (ev.useMemPool)
+  {
+    std::map<std::pair<MemType, int>, int> numUses;
+    for (TransferInfo const& t : possibleTransfers)
+    {
+      numUses[std::make_pair(t.srcType, t.srcIndex)]++;
+      numUses[std::make_pair(t.dstType, t.dstIndex)]++;
+    }
+
+    size_t const numBytes = numBytesPerTransfer + ev.byteOffset;
+    std::vector<std::tuple<MemType, int, void*>> buffers;
+    for (auto const& memUses : numUses)
+    {
+      MemType const memType  = memUses.first.first;
+      int     const memIndex = RemappedIndex(memUses.first.second, IsCpuType(memType));
+      for (int i = 0; i < std::min(memUses.second, maxParallelTransfers); i++)
+      {
+        void* memPtr;
+        AcquireMemory(ev, memType, memIndex, numBytes, &memPtr);
+        buffers.push_back(std::make_tuple(memType, memIndex, memPtr));
+      }
+    }
+    for (auto const& buffer : buffers)
+      ReleaseMemory(ev, std::get<0>(buffer), std::get<2>(buffer), numBytes);
+  }
+
   if (ev.outputToCsv)
   {
     printf("\nTest#,Transfer#,NumBytes,Src,Exe,Dst,CUs,BW(GB/s),Time(ms),"
@@ -2394,6 +6161,7 @@ void RunSweepPreset(EnvVars const& ev, size_t const numBytesPerTransfer, int con
   }
 
   int numTestsRun = 0;
+  int testNum = completed.size();
   int M = ev.sweepMin;
   std::uniform_int_distribution<int> randSize(1, numBytesPerTransfer / sizeof(float));
   std::uniform_int_distribution<int> distribution(ev.sweepMin, maxParallelTransfers);
@@ -2406,47 +6174,165 @@ void RunSweepPreset(EnvVars const& ev, size_t const numBytesPerTransfer, int con
     exit(1);
   }
 
-  // Create bitmask of numPossible triplets, of which M will be chosen
-  std::string bitmask(M, 1);  bitmask.resize(numPossible, 0);
+  // Ordered sweeps walk through combinations of M Transfers, either sorted by contention score (when there are
+  // few enough to enumerate) or in lexicographic order via a bitmask of numPossible triplets of which M are chosen
+  std::string bitmask;
+  bool isFirstOfSize = true;
+  bool usePriority   = false;
+  std::vector<int> prioritized;
+  std::vector<size_t> priorityOrder;
+  size_t priorityPos = 0;
+  auto startComboSize = [&]()
+  {
+    isFirstOfSize = true;
+    priorityPos   = 0;
+    prioritized.clear();
+    priorityOrder.clear();
+
+    // Count combinations, stopping once past the limit
+    size_t numCombos = 1;
+    for (int i = 1; i <= M && numCombos <= MAX_PRIORITIZED_COMBOS; i++)
+      numCombos = numCombos * (numPossible - M + i) / i;
+
+    usePriority = ev.sweepPrioritize && numCombos <= MAX_PRIORITIZED_COMBOS;
+    if (usePriority)
+    {
+      std::vector<int> combo(M);
+      for (int i = 0; i < M; i++) combo[i] = i;
+      std::vector<size_t> scores;
+      while (true)
+      {
+        prioritized.insert(prioritized.end(), combo.begin(), combo.end());
+        scores.push_back(contentionScore(combo.data(), M));
+
+        int i = M - 1;
+        while (i >= 0 && combo[i] == numPossible - M + i) i--;
+        if (i < 0) break;
+        combo[i]++;
+        for (int j = i + 1; j < M; j++) combo[j] = combo[j-1] + 1;
+      }
+      priorityOrder.resize(scores.size());
+      for (size_t i = 0; i < scores.size(); i++) priorityOrder[i] = i;
+      std::stable_sort(priorityOrder.begin(), priorityOrder.end(),
+                       [&](size_t a, size_t b) { return scores[a] > scores[b]; });
+    }
+    else
+    {
+      bitmask.assign(M, 1);
+      bitmask.resize(numPossible, 0);
+    }
+  };
+  auto nextOrderedCombo = [&](std::vector<int>& combo)
+  {
+    while (M <= maxParallelTransfers)
+    {
+      if (usePriority && priorityPos < priorityOrder.size())
+      {
+        combo.assign(prioritized.begin() + priorityOrder[priorityPos] * M,
+                     prioritized.begin() + (priorityOrder[priorityPos] + 1) * M);
+        priorityPos++;
+        return true;
+      }
+      if (!usePriority && (isFirstOfSize || std::prev_permutation(bitmask.begin(), bitmask.end())))
+      {
+        isFirstOfSize = false;
+        combo.clear();
+        for (int i = 0; i < numPossible; i++)
+          if (bitmask[i]) combo.push_back(i);
+        return true;
+      }
+      M++;
+      if (M <= maxParallelTransfers) startComboSize();
+    }
+    return false;
+  };
+
+  if (!isRandom) startComboSize();
+
   auto cpuStart = std::chrono::high_resolution_clock::now();
   while (1)
   {
+    std::vector<int> combo;
     if (isRandom)
     {
-      // Pick random number of simultaneous transfers to execute
-      // NOTE: This currently skews distribution due to some #s having more possibilities than others
-      M = distribution(*ev.generator);
+      // Pick the most contended of several random untested combinations
+      int const numCandidates = (ev.sweepPrioritize ? NUM_PRIORITY_CANDIDATES : 1);
+      size_t bestScore = 0;
+      int numDuplicates = 0;
+      for (int c = 0; c < numCandidates && numDuplicates < MAX_SWEEP_DUPLICATES; )
+      {
+        // Pick random number of simultaneous transfers to execute
+        // NOTE: This currently skews distribution due to some #s having more possibilities than others
+        M = distribution(*ev.generator);
+
+        // Generate a random bitmask
+        bitmask.assign(M, 1);
+        bitmask.resize(numPossible, 0);
+        std::shuffle(bitmask.begin(), bitmask.end(), *ev.generator);
+
+        std::vector<int> candidate;
+        for (int i = 0; i < numPossible; i++)
+          if (bitmask[i]) candidate.push_back(i);
+        if (completed.count(comboKey(candidate)))
+        {
+          numDuplicates++;
+          continue;
+        }
 
-      // Generate a random bitmask
-      for (int i = 0; i < numPossible; i++)
-        bitmask[i] = (i < M) ? 1 : 0;
-      std::shuffle(bitmask.begin(), bitmask.end(), *ev.generator);
+        size_t const score = contentionScore(candidate.data(), candidate.size());
+        if (c == 0 || score > bestScore)
+        {
+          combo     = candidate;
+          bestScore = score;
+        }
+        c++;
+      }
+      if (combo.empty())
+      {
+        printf("No untested combinations found\n");
+        break;
+      }
     }
-
-    // Convert bitmask to list of Transfers
-    std::vector<Transfer> transfers;
-    for (int value = 0; value < numPossible; ++value)
+    else
     {
-      if (bitmask[value])
+      if (!nextOrderedCombo(combo))
       {
-        // Convert integer value to (SRC->EXE->DST) triplet
-        Transfer transfer;
-        transfer.numSrcs        = 1;
-        transfer.numDsts        = 1;
-        transfer.srcType        = {possibleTransfers[value].srcType};
-        transfer.srcIndex       = {possibleTransfers[value].srcIndex};
-        transfer.exeType        = possibleTransfers[value].exeType;
-        transfer.exeIndex       = possibleTransfers[value].exeIndex;
-        transfer.dstType        = {possibleTransfers[value].dstType};
-        transfer.dstIndex       = {possibleTransfers[value].dstIndex};
-        transfer.numSubExecs    = IsGpuType(transfer.exeType) ? numGpuSubExecs : numCpuSubExecs;
-        transfer.numBytes       = ev.sweepRandBytes ? randSize(*ev.generator) * sizeof(float) : 0;
-        transfers.push_back(transfer);
+        printf("Sweep complete\n");
+        break;
       }
+      if (completed.count(comboKey(combo))) continue;
+    }
+
+    // Convert combination to list of Transfers
+    std::vector<Transfer> transfers;
+    for (int value : combo)
+    {
+      // Convert integer value to (SRC->EXE->DST) triplet
+      Transfer transfer;
+      transfer.numSrcs        = 1;
+      transfer.numDsts        = 1;
+      transfer.srcType        = {possibleTransfers[value].srcType};
+      transfer.srcIndex       = {possibleTransfers[value].srcIndex};
+      transfer.exeType        = possibleTransfers[value].exeType;
+      transfer.exeIndex       = possibleTransfers[value].exeIndex;
+      transfer.dstType        = {possibleTransfers[value].dstType};
+      transfer.dstIndex       = {possibleTransfers[value].dstIndex};
+      transfer.numSubExecs    = IsGpuType(transfer.exeType) ? numGpuSubExecs : numCpuSubExecs;
+      transfer.numBytes       = ev.sweepRandBytes ? randSize(*ev.generator) * sizeof(float) : 0;
+      transfers.push_back(transfer);
     }
 
-    LogTransfers(fp, ++numTestsRun, transfers);
-    ExecuteTransfers(ev, numTestsRun, numBytesPerTransfer / sizeof(float), transfers);
+    LogTransfers(fp, ++testNum, transfers);
+    ExecuteTransfers(ev, testNum, numBytesPerTransfer / sizeof(float), transfers);
+    numTestsRun++;
+
+    std::string const key = comboKey(combo);
+    completed.insert(key);
+    if (checkpointFp)
+    {
+      fprintf(checkpointFp, "%s\n", key.c_str());
+      fflush(checkpointFp);
+    }
 
     // Check for test limit
     if (numTestsRun == ev.sweepTestLimit)
@@ -2463,22 +6349,9 @@ void RunSweepPreset(EnvVars const& ev, size_t const numBytesPerTransfer, int con
       printf("Time limit exceeded\n");
       break;
     }
-
-    // Increment bitmask if not random sweep
-    if (!isRandom && !std::prev_permutation(bitmask.begin(), bitmask.end()))
-    {
-      M++;
-      // Check for completion
-      if (M > maxParallelTransfers)
-      {
-        printf("Sweep complete\n");
-        break;
-      }
-      for (int i = 0; i < numPossible; i++)
-        bitmask[i] = (i < M) ? 1 : 0;
-    }
   }
   fclose(fp);
+  if (checkpointFp) fclose(checkpointFp);
 }
 
 void LogTransfers(FILE *fp, int const testNum, std::vector<Transfer> const& transfers)
@@ -2508,3 +6381,69 @@ std::string PtrVectorToStr(std::vector<float*> const& strVector, int const initO
   }
   return ss.str();
 }
+
+void PrintGpuCounters(std::map<std::string, double> const& gpuCounters)
+{
+  // Counters are displayed in the order they were requested in GPU_COUNTERS
+  printf("      Counters    |");
+  for (std::string const& name : GpuCounterNames())
+  {
+    auto it = gpuCounters.find(name);
+    if (it != gpuCounters.end()) printf(" %s %.6g |", name.c_str(), it->second);
+  }
+  printf(" (per iteration)\n");
+}
+
+void PrintChunkStats(std::vector<size_t> const& numChunksPerSubExec, size_t const numTimedIterations)
+{
+  // An even spread means every subExecutor kept busy until the Transfer ran out of work
+  size_t const minChunks = *std::min_element(numChunksPerSubExec.begin(), numChunksPerSubExec.end());
+  size_t const maxChunks = *std::max_element(numChunksPerSubExec.begin(), numChunksPerSubExec.end());
+  double const avgChunks = std::accumulate(numChunksPerSubExec.begin(), numChunksPerSubExec.end(), 0.0) /
+                           numChunksPerSubExec.size();
+  printf("      Chunks      | min %8.2f | avg %8.2f | max %8.2f | per subExecutor per iteration\n",
+         minChunks / (double)numTimedIterations, avgChunks / numTimedIterations, maxChunks / (double)numTimedIterations);
+}
+
+void GetLatencyStats(LatencyHistogram const& histogram, double* stats)
+{
+  stats[0] = histogram.Percentile(50.0);
+  stats[1] = histogram.Percentile(90.0);
+  stats[2] = histogram.Percentile(99.0);
+  stats[3] = histogram.Percentile(99.9);
+  stats[4] = histogram.Max();
+  stats[5] = histogram.StdDev();
+}
+
+void PrintLatencyStats(LatencyHistogram const& histogram, char const* label)
+{
+  double stats[NUM_LATENCY_STATS];
+  GetLatencyStats(histogram, stats);
+  PrintLatencyStatValues(stats, label);
+}
+
+void PrintLatencyStatValues(double const* stats, char const* label)
+{
+  printf("      %-11s | p50 %8.3f | p90 %8.3f | p99 %8.3f | p99.9 %8.3f | max %8.3f | stddev %8.3f ms\n",
+         label, stats[0], stats[1], stats[2], stats[3], stats[4], stats[5]);
+}
+
+// Returns additional CSV columns with latency statistics (empty if SHOW_PERCENTILES is disabled)
+std::string LatencyStatsCsv(EnvVars const& ev, LatencyHistogram const* histogram)
+{
+  if (!ev.showPercentiles) return "";
+  if (!histogram) return ",,,,,,";
+
+  double stats[NUM_LATENCY_STATS];
+  GetLatencyStats(*histogram, stats);
+  return LatencyStatValuesCsv(ev, stats);
+}
+
+std::string LatencyStatValuesCsv(EnvVars const& ev, double const* stats)
+{
+  if (!ev.showPercentiles) return "";
+
+  char buffer[256];
+  sprintf(buffer, ",%.3f,%.3f,%.3f,%.3f,%.3f,%.3f", stats[0], stats[1], stats[2], stats[3], stats[4], stats[5]);
+  return buffer;
+}
@@ -0,0 +1,262 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include "ResultsSink.hpp"
+
+// Parsed JSON value (only what is required to read back records written by ResultsSink)
+struct JsonValue
+{
+  enum Type { JSON_NULL, JSON_BOOL, JSON_NUMBER, JSON_STRING, JSON_ARRAY, JSON_OBJECT };
+
+  Type                             type = JSON_NULL;
+  bool                             boolean = false;
+  double                           number = 0.0;
+  std::string                      str;
+  std::vector<JsonValue>           array;
+  std::map<std::string, JsonValue> object;
+
+  // Returns the member with the given name, or a null value if not present
+  JsonValue const& operator[](std::string const& key) const
+  {
+    static JsonValue const nullValue;
+    auto it = object.find(key);
+    return (it == object.end() ? nullValue : it->second);
+  }
+
+  // Parse a single JSON value, advancing ptr past it.  Returns false on malformed input
+  static bool Parse(char const*& ptr, JsonValue& value)
+  {
+    SkipSpace(ptr);
+    switch (*ptr)
+    {
+    case '{':
+      value.type = JSON_OBJECT;
+      ptr++;
+      SkipSpace(ptr);
+      if (*ptr == '}') { ptr++; return true; }
+      while (true)
+      {
+        std::string key;
+        SkipSpace(ptr);
+        if (!ParseString(ptr, key)) return false;
+        SkipSpace(ptr);
+        if (*ptr++ != ':') return false;
+        if (!Parse(ptr, value.object[key])) return false;
+        SkipSpace(ptr);
+        if (*ptr == ',') { ptr++; continue; }
+        if (*ptr == '}') { ptr++; return true; }
+        return false;
+      }
+    case '[':
+      value.type = JSON_ARRAY;
+      ptr++;
+      SkipSpace(ptr);
+      if (*ptr == ']') { ptr++; return true; }
+      while (true)
+      {
+        value.array.emplace_back();
+        if (!Parse(ptr, value.array.back())) return false;
+        SkipSpace(ptr);
+        if (*ptr == ',') { ptr++; continue; }
+        if (*ptr == ']') { ptr++; return true; }
+        return false;
+      }
+    case '"':
+      value.type = JSON_STRING;
+      return ParseString(ptr, value.str);
+    case 't': value.type = JSON_BOOL; value.boolean = true;  return Match(ptr, "true");
+    case 'f': value.type = JSON_BOOL; value.boolean = false; return Match(ptr, "false");
+    case 'n': value.type = JSON_NULL;                        return Match(ptr, "null");
+    default:
+    {
+      char* end;
+      value.type   = JSON_NUMBER;
+      value.number = strtod(ptr, &end);
+      if (end == ptr) return false;
+      ptr = end;
+      return true;
+    }
+    }
+  }
+
+private:
+  static void SkipSpace(char const*& ptr) { while (isspace((unsigned char)*ptr)) ptr++; }
+
+  static bool Match(char const*& ptr, char const* literal)
+  {
+    size_t const len = strlen(literal);
+    if (strncmp(ptr, literal, len)) return false;
+    ptr += len;
+    return true;
+  }
+
+  static bool ParseString(char const*& ptr, std::string& result)
+  {
+    if (*ptr++ != '"') return false;
+    while (*ptr && *ptr != '"')
+    {
+      if (*ptr == '\\')
+      {
+        ptr++;
+        switch (*ptr)
+        {
+        case 'n': result += '\n'; break;
+        case 't': result += '\t'; break;
+        case 'u': result += (char)strtol(std::string(ptr + 1, 4).c_str(), NULL, 16); ptr += 4; break;
+        default:  result += *ptr; break;
+        }
+        if (!*ptr) return false;
+        ptr++;
+      }
+      else
+        result += *ptr++;
+    }
+    if (*ptr++ != '"') return false;
+    return true;
+  }
+};
+
+// Compares Transfer bandwidths against those recorded in a previous RESULTS_FILE
+// Transfers are matched by preset, Test shape (# of Transfers, Transfer index, SRC / EXE / DST, size, subExecutors)
+// and by how many times that same Transfer has already been seen, so that repeated Tests match up in order
+class BaselineChecker
+{
+public:
+  static BaselineChecker& Get()
+  {
+    static BaselineChecker checker;
+    return checker;
+  }
+
+  static std::string MakeKey(std::string const& preset, int const numTransfers, int const transferIdx,
+                             std::string const& src, std::string const& exe, int const exeRank,
+                             std::string const& dst, size_t const numBytes, int const numSubExecs)
+  {
+    return preset + "|" + std::to_string(numTransfers) + "|" + std::to_string(transferIdx) + "|" +
+      src + "|" + exe + "." + std::to_string(exeRank) + "|" + dst + "|" +
+      std::to_string(numBytes) + "|" + std::to_string(numSubExecs);
+  }
+
+  void Load(std::string const& filename)
+  {
+    FILE* fp = fopen(filename.c_str(), "r");
+    if (!fp)
+    {
+      printf("[ERROR] Unable to open baseline file [%s]\n", filename.c_str());
+      exit(1);
+    }
+
+    std::map<std::string, int> occurrences;
+    std::string line;
+    char buffer[4096];
+    int lineNum = 0;
+    while (fgets(buffer, sizeof(buffer), fp))
+    {
+      line += buffer;
+      if (line.back() != '\n' && !feof(fp)) continue;
+      lineNum++;
+      if (line.find_first_not_of(" \t\r\n") == std::string::npos) { line.clear(); continue; }
+
+      JsonValue record;
+      char const* ptr = line.c_str();
+      if (!JsonValue::Parse(ptr, record) || record.type != JsonValue::JSON_OBJECT)
+      {
+        printf("[ERROR] Unable to parse line %d of baseline file [%s]\n", lineNum, filename.c_str());
+        exit(1);
+      }
+      line.clear();
+
+      if (record["schema"].number != RESULTS_SCHEMA_VERSION)
+      {
+        printf("[ERROR] Baseline file [%s] uses results schema %d (expected %d)\n",
+               filename.c_str(), (int)record["schema"].number, RESULTS_SCHEMA_VERSION);
+        exit(1);
+      }
+      if (record["type"].str != "test") continue;
+
+      std::vector<JsonValue> const& transfers = record["transfers"].array;
+      for (JsonValue const& t : transfers)
+      {
+        std::string const key = MakeKey(record["preset"].str, transfers.size(), (int)t["index"].number,
+                                        t["src"].str, t["exe"].str, (int)t["exeRank"].number, t["dst"].str,
+                                        (size_t)t["numBytes"].number, (int)t["numSubExecs"].number);
+        // Re-runs that confirmed / cleared a regression replace the result of the original run
+        int& count = occurrences[key];
+        if (record["retry"].boolean && count > 0) count--;
+        bandwidths[key + "#" + std::to_string(count++)] = t["bandwidthGbs"].number;
+      }
+    }
+    fclose(fp);
+    isLoaded = true;
+  }
+
+  bool IsLoaded() const { return isLoaded; }
+
+  // Returns baseline key for this occurrence of the given Transfer key
+  std::string NextKey(std::string const& key) { return key + "#" + std::to_string(occurrences[key]++); }
+
+  // Returns false if there is no baseline entry for this key
+  bool GetBaseline(std::string const& key, double& bandwidthGbs) const
+  {
+    auto it = bandwidths.find(key);
+    if (it == bandwidths.end()) return false;
+    bandwidthGbs = it->second;
+    return true;
+  }
+
+  // Tally results of a comparison
+  void AddResult(bool const isMissing, bool const isRegression)
+  {
+    if (isMissing)         numMissing++;
+    else if (isRegression) numRegressions++;
+    else                   numPassed++;
+  }
+
+  // Display summary and return exit code for the run (non-zero if any regressions were detected)
+  int Finalize() const
+  {
+    if (!isLoaded) return 0;
+    printf("Baseline comparison: %d passed, %d regressed, %d without baseline\n",
+           numPassed, numRegressions, numMissing);
+    return numRegressions ? 2 : 0;
+  }
+
+  bool                     isRetrying = false; // Set while a Test is being re-run to confirm a regression
+  std::vector<std::string> testKeys;           // Baseline keys of the Transfers of the current Test
+
+private:
+  bool                          isLoaded = false;
+  std::map<std::string, double> bandwidths;   // Baseline bandwidth (GB/s) by key
+  std::map<std::string, int>    occurrences;  // # of times each key has been seen this run
+  int                           numPassed = 0;
+  int                           numRegressions = 0;
+  int                           numMissing = 0;
+};
@@ -34,6 +34,9 @@ THE SOFTWARE.
 #define hipDeviceProp_t                                    cudaDeviceProp
 #define hipError_t                                         cudaError_t
 #define hipEvent_t                                         cudaEvent_t
+#define hipGraph_t                                         cudaGraph_t
+#define hipGraphExec_t                                     cudaGraphExec_t
+#define hipIpcMemHandle_t                                  cudaIpcMemHandle_t
 #define hipStream_t                                        cudaStream_t
 
 // Enumerations
@@ -42,9 +45,14 @@ THE SOFTWARE.
 #define hipDeviceAttributeMultiprocessorCount              cudaDevAttrMultiProcessorCount
 #define hipErrorPeerAccessAlreadyEnabled                   cudaErrorPeerAccessAlreadyEnabled
 #define hipFuncCachePreferShared                           cudaFuncCachePreferShared
+#define hipIpcMemLazyEnablePeerAccess                      cudaIpcMemLazyEnablePeerAccess
+#define hipCpuDeviceId                                     cudaCpuDeviceId
+#define hipMemAdviseSetPreferredLocation                   cudaMemAdviseSetPreferredLocation
+#define hipMemAdviseSetReadMostly                          cudaMemAdviseSetReadMostly
 #define hipMemcpyDefault                                   cudaMemcpyDefault
 #define hipMemcpyDeviceToHost                              cudaMemcpyDeviceToHost
 #define hipMemcpyHostToDevice                              cudaMemcpyHostToDevice
+#define hipStreamCaptureModeThreadLocal                    cudaStreamCaptureModeThreadLocal
 #define hipSuccess                                         cudaSuccess
 
 // Functions
@@ -59,20 +67,40 @@ THE SOFTWARE.
 #define hipEventElapsedTime                                cudaEventElapsedTime
 #define hipEventRecord                                     cudaEventRecord
 #define hipFree                                            cudaFree
+#define hipGetDevice                                       cudaGetDevice
 #define hipGetDeviceCount                                  cudaGetDeviceCount
 #define hipGetDeviceProperties                             cudaGetDeviceProperties
 #define hipGetErrorString                                  cudaGetErrorString
+#define hipGetLastError                                    cudaGetLastError
+#define hipGraphDestroy                                    cudaGraphDestroy
+#define hipGraphExecDestroy                                cudaGraphExecDestroy
+#define hipGraphInstantiateWithFlags                       cudaGraphInstantiateWithFlags
+#define hipGraphLaunch                                     cudaGraphLaunch
 #define hipHostFree                                        cudaFreeHost
 #define hipHostMalloc                                      cudaMallocHost
+#define hipHostRegister                                    cudaHostRegister
+#define hipHostRegisterDefault                             cudaHostRegisterDefault
+#define hipHostUnregister                                  cudaHostUnregister
+#define hipIpcCloseMemHandle                               cudaIpcCloseMemHandle
+#define hipIpcGetMemHandle                                 cudaIpcGetMemHandle
+#define hipIpcOpenMemHandle                                cudaIpcOpenMemHandle
 #define hipMalloc                                          cudaMalloc
+#define hipMallocManaged                                   cudaMallocManaged
+#define hipMemAdvise                                       cudaMemAdvise
 #define hipMemcpy                                          cudaMemcpy
 #define hipMemcpyAsync                                     cudaMemcpyAsync
+#define hipMemPrefetchAsync                                cudaMemPrefetchAsync
 #define hipMemset                                          cudaMemset
 #define hipMemsetAsync                                     cudaMemsetAsync
 #define hipSetDevice                                       cudaSetDevice
+#define hipStreamBeginCapture                              cudaStreamBeginCapture
 #define hipStreamCreate                                    cudaStreamCreate
+#define hipStreamCreateWithFlags                           cudaStreamCreateWithFlags
 #define hipStreamDestroy                                   cudaStreamDestroy
+#define hipStreamEndCapture                                cudaStreamEndCapture
+#define hipStreamNonBlocking                               cudaStreamNonBlocking
 #define hipStreamSynchronize                               cudaStreamSynchronize
+#define hipStreamWaitEvent                                 cudaStreamWaitEvent
 
 // Define float4 addition operator for NVIDIA platform
 __device__ inline float4& operator +=(float4& a, const float4& b)
@@ -0,0 +1,171 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <numa.h>
+#include <pthread.h>
+#include <sched.h>
+
+// Persistent pool of worker threads for a single NUMA node
+// Each worker is pinned to one core of the NUMA node and sleeps until it is handed a task (e.g. a subExecutor) to run.
+// Worker w is pinned to the ((coreOffset + w * coreStride) % numCores)-th core of the node
+class CpuThreadPool
+{
+public:
+  CpuThreadPool(int const numaNode, int const coreOffset, int const coreStride) :
+    numaNode(numaNode), coreOffset(coreOffset), coreStride(coreStride)
+  {
+    // Collect the cores belonging to this NUMA node
+    int const totalCpus = numa_num_configured_cpus();
+    for (int i = 0; i < totalCpus; i++)
+      if (numa_node_of_cpu(i) == numaNode) cores.push_back(i);
+  }
+
+  ~CpuThreadPool()
+  {
+    for (auto& worker : workers)
+    {
+      {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->quit = true;
+      }
+      worker->cv.notify_all();
+      worker->thread.join();
+    }
+  }
+
+  // Number of cores that workers are pinned across (workers beyond this share cores)
+  int NumCores() const { return cores.size(); }
+
+  // Launch workers so that at least numWorkers are available
+  void Reserve(size_t const numWorkers)
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    while (workers.size() < numWorkers)
+    {
+      std::unique_ptr<Worker> worker(new Worker);
+      Worker* workerPtr = worker.get();
+      worker->thread = std::thread(WorkerLoop, workerPtr);
+
+      // Pin worker to its assigned core, or just to the NUMA node if no cores are known
+      if (cores.size())
+      {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cores[(coreOffset + workers.size() * coreStride) % cores.size()], &cpuSet);
+        if (pthread_setaffinity_np(worker->thread.native_handle(), sizeof(cpuSet), &cpuSet))
+        {
+          RunError("Unable to pin CPU worker thread to core on NUMA node %d", numaNode);
+        }
+      }
+      workers.push_back(std::move(worker));
+    }
+  }
+
+  // Run task on worker workerIdx without waiting for it to complete (see Wait)
+  void Launch(int const workerIdx, std::function<void()> task)
+  {
+    Reserve(workerIdx + 1);
+
+    Worker* worker;
+    {
+      std::lock_guard<std::mutex> lock(poolMutex);
+      worker = workers[workerIdx].get();
+    }
+    {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      worker->task = std::move(task);
+    }
+    worker->cv.notify_all();
+  }
+
+  // Block until the task launched on worker workerIdx has completed
+  void Wait(int const workerIdx)
+  {
+    Worker* worker;
+    {
+      std::lock_guard<std::mutex> lock(poolMutex);
+      worker = workers[workerIdx].get();
+    }
+    std::unique_lock<std::mutex> lock(worker->mutex);
+    worker->cv.wait(lock, [&]{ return !worker->task; });
+  }
+
+  // Run each of the subExecutors in subExecParams on workers [workerOffset, workerOffset + subExecParams.size())
+  // and block until all of them have completed
+  void Execute(int const workerOffset, std::vector<SubExecParam> const& subExecParams, CpuKernelFuncPtr kernel)
+  {
+    int const numSubExecs = subExecParams.size();
+    Reserve(workerOffset + numSubExecs);
+
+    // Wake up workers
+    for (int i = 0; i < numSubExecs; i++)
+    {
+      SubExecParam const* param = &subExecParams[i];
+      Launch(workerOffset + i, [kernel, param]() { kernel(*param); });
+    }
+
+    // Wait for all workers to finish
+    for (int i = 0; i < numSubExecs; i++)
+      Wait(workerOffset + i);
+  }
+
+private:
+  struct Worker
+  {
+    std::thread             thread;
+    std::mutex              mutex;
+    std::condition_variable cv;
+    std::function<void()>   task;             // Task to run (empty when idle)
+    bool                    quit = false;
+  };
+
+  static void WorkerLoop(Worker* worker)
+  {
+    std::unique_lock<std::mutex> lock(worker->mutex);
+    while (true)
+    {
+      worker->cv.wait(lock, [&]{ return worker->task || worker->quit; });
+      if (worker->quit) break;
+
+      lock.unlock();
+      worker->task();
+      lock.lock();
+
+      worker->task = nullptr;
+      worker->cv.notify_all();
+    }
+  }
+
+  int                                  numaNode;
+  int                                  coreOffset;
+  int                                  coreStride;
+  std::vector<int>                     cores;      // Cores belonging to this NUMA node
+  std::vector<std::unique_ptr<Worker>> workers;
+  std::mutex                           poolMutex;  // Protects growth of workers
+};
@@ -24,12 +24,18 @@ THE SOFTWARE.
 #define ENVVARS_HPP
 
 #include <algorithm>
+#include <map>
 #include <random>
 #include <time.h>
 #include "Compatibility.hpp"
 #include "Kernels.hpp"
+#include "ResultsSink.hpp"
 
-#define TB_VERSION "1.38"
+#define TB_VERSION "1.68"
+
+// With USE_ASYNC_LAUNCH, iterations are enqueued in batches of up to this many, each iteration of a batch writing
+// timestamps to its own copy (slice) of the subExecutor parameters, which are read back before the next batch
+#define MAX_ASYNC_PARAM_SLICES 64
 
 extern char const MemTypeStr[];
 extern char const ExeTypeStr[];
@@ -40,8 +46,16 @@ enum ConfigModeEnum
   CFG_P2P   = 1,
   CFG_SWEEP = 2,
   CFG_SCALE = 3,
-  CFG_A2A   = 4
+  CFG_A2A   = 4,
+  CFG_COLL  = 5,
+  CFG_PIPE  = 6,
+  CFG_TUNE  = 7,
+  CFG_CONTENTION = 8,
+  CFG_HEALTH = 9,
+  CFG_LATENCY = 10
 };
+char const ConfigModeName[][16] = {"file", "p2p", "sweep", "scaling", "a2a", "coll", "pipeline", "autotune", "contention",
+                                   "healthcheck", "latency"};
 
 enum BlockOrderEnum
 {
@@ -73,29 +87,60 @@ public:
 
   // Environment variables
   int alwaysValidate;    // Validate after each iteration instead of once after all iterations
+  std::string baselineFile;    // Results file of a previous run to compare bandwidths against
+  int baselineRetryIterations; // Re-run Tests that regress against the baseline with this many iterations (0 = disabled)
+  int baselineTolerance;       // Allowed bandwidth drop (%) relative to the baseline before a Transfer is flagged
+  int bgBytes;           // Size (in bytes) of each buffer streamed by the memory-bound background load
+  int bgLoad;            // Background load run on each GPU executor's device during a Test (0=None, 1=Compute, 2=Memory)
+  int bgNumBlocks;       // Number of persistent threadblocks used by the background load (0 = one per CU)
   int blockSize;         // Size of each threadblock (must be multiple of 64)
   int blockBytes;        // Each CU, except the last, gets a multiple of this many bytes to copy
   int blockOrder;        // How blocks are ordered in single-stream mode (0=Sequential, 1=Interleaved, 2=Random)
   int byteOffset;        // Byte-offset for memory allocations
   int continueOnError;   // Continue tests even after mismatch detected
+  int cpuCoreOffset;     // Core within NUMA node that the first CPU worker thread is pinned to
+  int cpuCoreStride;     // Core stride between consecutive CPU worker threads
+  int cpuKernel;         // Which CPU kernel to use
+  int dataType;          // Element datatype used for reductions (see DataType)
+  std::string gpuCounters; // Comma-separated hardware counters to collect per Transfer (requires rocprofiler-sdk)
   int hideEnv;           // Skip printing environment variable
+  int hugePageSizeMb;    // Size of huge pages (in MB) backing huge-page host memory (H)
+  int managedAdvice;     // Memory advice applied to managed memory (M)
+  int managedFirstTouch; // Where managed memory is first touched (0=GPU, 1=CPU)
+  int managedPrefetch;   // Where managed memory is prefetched to prior to first iteration (0=None, 1=GPU, 2=CPU)
+  int nativeAccum;       // Accumulate in the element datatype instead of fp32
   int numCpuDevices;     // Number of CPU devices to use (defaults to # NUMA nodes detected)
   int numGpuDevices;     // Number of GPU devices to use (defaults to # HIP devices detected)
   int numIterations;     // Number of timed iterations to perform.  If negative, run for -numIterations seconds instead
   int numWarmups;        // Number of un-timed warmup iterations to perform
   int outputToCsv;       // Output in CSV format
+  std::string resultsFile; // File to stream structured results to as JSON lines
+  int sampleGpuStats;    // Include GPU clock / power readings in each sampling window
+  std::string sampleFile; // File to write sampling windows to as CSV (in addition to stdout)
+  int sampleWindowMs;    // Report per-Transfer bandwidth in windows of this many milliseconds (0 = disabled)
   int samplingFactor;    // Affects how many different values of N are generated (when N set to 0)
   int sharedMemBytes;    // Amount of shared memory to use per threadblock
   int showIterations;    // Show per-iteration timing info
+  int showPercentiles;   // Show per-iteration latency percentiles
+  int stealChunkBytes;   // Size of each chunk claimed by threadblocks of the work-stealing GPU kernel
+  int useAsyncLaunch;    // Enqueue iterations back-to-back per executor, synchronizing only between batches
+  int useHipGraph;       // Capture GPU launches into HIP graphs and replay them for each iteration
+  int useHsaDma;         // Execute DMA Transfers via HSA on explicitly selected SDMA engines
+  int useCpuThreadPool;  // Use persistent core-pinned worker threads for CPU executors
   int useInteractive;    // Pause for user-input before starting transfer loop
+  int useMemPool;        // Reuse memory allocations and streams across Tests instead of re-allocating per Test
+  int useShapeKernels;   // Use GPU kernels specialized for common Transfer shapes (#srcs -> #dsts) when possible
   int usePcieIndexing;   // Base GPU indexing on PCIe address instead of HIP device
   int usePrepSrcKernel;  // Use GPU kernel to prepare source data instead of copy (can't be used with fillPattern)
   int useSingleStream;   // Use a single stream per GPU GFX executor instead of stream per Transfer
+  int useWaveSubExec;    // GFX subExecutors are wavefronts instead of threadblocks
   int useXccFilter;      // Use XCC filtering (experimental)
   int validateDirect;    // Validate GPU destination memory directly instead of staging GPU memory on host
+  int validateOnGpu;     // Validate GPU memory in place with a GPU kernel instead of comparing on the host
 
   std::vector<float> fillPattern; // Pattern of floats used to fill source data
   std::vector<uint32_t> cuMask;   // Bit-vector representing the CU mask
+  std::vector<uint32_t> bgCuMask; // Bit-vector representing the CU mask of the background load
   std::vector<std::vector<int>> prefXccTable;
 
   // Environment variables only for P2P preset
@@ -118,10 +163,39 @@ public:
   std::string sweepSrc;  // Set of src memory types to be swept
   std::string sweepExe;  // Set of executors to be swept
   std::string sweepDst;  // Set of dst memory types to be swept
+  int sweepPrioritize;   // Test combinations with the most Transfers sharing links / executors first
+  std::string sweepCheckpoint; // File to record completed combinations to / resume sweep from
 
   // Enviroment variables only for A2A preset
   int a2aDirect;         // Only execute on links that are directly connected
 
+  // Environment variables only for collective presets
+  int collChunkBytes;    // Max bytes sent per Transfer per pipeline step (0 = no chunking)
+  std::vector<int> collRingOrder; // Order of GPUs around the ring / tree
+
+  // Environment variables only for pipeline preset
+  std::string pipelinePath; // Comma-separated memory locations that chunks are forwarded through
+  int pipelineChunkBytes;   // Size of each chunk in bytes
+  int pipelineDepth;        // Max # of chunks in flight between consecutive hops
+
+  // Environment variables only for contention preset
+  int contentionAll;     // Measure all pairs of flows, including those on separate direct XGMI links
+
+  // Environment variables only for healthcheck preset
+  std::string hcExpectedFile; // File of expected bandwidth per link class (otherwise the median of each class is used)
+  int hcMinBw;           // Absolute bandwidth floor (GB/s) that every Transfer must reach (0 = none)
+  int hcTimeLimit;       // Time budget in seconds for the whole health check (0 = no limit)
+  int hcTolerance;       // Allowed bandwidth drop (%) relative to the expected value of a link class
+
+  // Environment variables only for latency preset
+  int latencyMode;       // Both = 0, Pointer-chase only = 1, Ping-pong only = 2
+  int latencyRoundTrips; // Number of flag round trips per ping-pong measurement
+  int latencySteps;      // Number of dependent loads per pointer-chase measurement
+  int latencyStride;     // Size in bytes of each element of the pointer-chase chain
+
+  // Environment variables for autotune preset / "auto" #SubExecs
+  std::string autotuneFile; // Tuning table written by autotune preset and read for "auto" #SubExecs
+
   // Developer features
   int enableDebug;       // Enable debug output
   int gpuKernel;         // Which GPU kernel to use
@@ -139,8 +213,17 @@ public:
 
   std::vector<std::set<int>> xccIdsPerDevice;
 
-  // Constructor that collects values
-  EnvVars()
+  // Settings that are used in place of environment variables (e.g. by each libtransferbench Context)
+  struct SettingsSource
+  {
+    std::map<std::string, std::string> values;       // Variable name to value
+    bool                               useProcessEnv = true; // Whether variables missing from values are read via getenv
+  };
+  SettingsSource settings;
+
+  // Constructors that collect values (from the process environment unless other settings are given)
+  EnvVars() : EnvVars(SettingsSource()) {}
+  EnvVars(SettingsSource const& source) : settings(source)
   {
     int maxSharedMemBytes = 0;
     HIP_CALL(hipDeviceGetAttribute(&maxSharedMemBytes,
@@ -173,26 +256,55 @@ public:
     else if (archName == "gfx942") defaultGpuKernel = 3;
 
     alwaysValidate    = GetEnvVar("ALWAYS_VALIDATE"     , 0);
+    baselineFile      = GetEnvVar("BASELINE_FILE"       , "");
+    baselineRetryIterations = GetEnvVar("BASELINE_RETRY_ITERS", 0);
+    baselineTolerance = GetEnvVar("BASELINE_TOLERANCE"  , 10);
+    bgBytes           = GetEnvVar("BG_BYTES"            , 1<<28);
+    bgLoad            = GetEnvVar("BG_LOAD"             , 0);
+    bgNumBlocks       = GetEnvVar("BG_NUM_BLOCKS"       , 0);
     blockSize         = GetEnvVar("BLOCK_SIZE"          , 256);
     blockBytes        = GetEnvVar("BLOCK_BYTES"         , 256);
     blockOrder        = GetEnvVar("BLOCK_ORDER"         , 0);
     byteOffset        = GetEnvVar("BYTE_OFFSET"         , 0);
     continueOnError   = GetEnvVar("CONTINUE_ON_ERROR"   , 0);
+    cpuCoreOffset     = GetEnvVar("CPU_CORE_OFFSET"     , 0);
+    cpuCoreStride     = GetEnvVar("CPU_CORE_STRIDE"     , 1);
+    cpuKernel         = GetEnvVar("CPU_KERNEL"          , 0);
+    gpuCounters       = GetEnvVar("GPU_COUNTERS"        , "");
     hideEnv           = GetEnvVar("HIDE_ENV"            , 0);
+    hugePageSizeMb    = GetEnvVar("HUGE_PAGE_SIZE_MB"   , 2);
+    managedAdvice     = GetEnvVar("MANAGED_ADVICE"      , 0);
+    managedFirstTouch = GetEnvVar("MANAGED_FIRST_TOUCH" , 0);
+    managedPrefetch   = GetEnvVar("MANAGED_PREFETCH"    , 0);
+    nativeAccum       = GetEnvVar("NATIVE_ACCUMULATE"   , 0);
     numCpuDevices     = GetEnvVar("NUM_CPU_DEVICES"     , numDetectedCpus);
     numGpuDevices     = GetEnvVar("NUM_GPU_DEVICES"     , numDetectedGpus);
     numIterations     = GetEnvVar("NUM_ITERATIONS"      , DEFAULT_NUM_ITERATIONS);
     numWarmups        = GetEnvVar("NUM_WARMUPS"         , DEFAULT_NUM_WARMUPS);
     outputToCsv       = GetEnvVar("OUTPUT_TO_CSV"       , 0);
+    resultsFile       = GetEnvVar("RESULTS_FILE"        , "");
+    sampleGpuStats    = GetEnvVar("SAMPLE_GPU_STATS"    , 0);
+    sampleFile        = GetEnvVar("SAMPLE_FILE"         , "");
+    sampleWindowMs    = GetEnvVar("SAMPLE_WINDOW_MS"    , 0);
     samplingFactor    = GetEnvVar("SAMPLING_FACTOR"     , DEFAULT_SAMPLING_FACTOR);
     sharedMemBytes    = GetEnvVar("SHARED_MEM_BYTES"    , defaultSharedMemBytes);
     showIterations    = GetEnvVar("SHOW_ITERATIONS"     , 0);
+    showPercentiles   = GetEnvVar("SHOW_PERCENTILES"    , 0);
+    stealChunkBytes   = GetEnvVar("STEAL_CHUNK_BYTES"   , 1<<18);
+    useAsyncLaunch    = GetEnvVar("USE_ASYNC_LAUNCH"    , 0);
+    useHipGraph       = GetEnvVar("USE_HIP_GRAPH"       , 0);
+    useHsaDma         = GetEnvVar("USE_HSA_DMA"         , 0);
+    useCpuThreadPool  = GetEnvVar("USE_CPU_THREAD_POOL" , 0);
     useInteractive    = GetEnvVar("USE_INTERACTIVE"     , 0);
+    useMemPool        = GetEnvVar("USE_MEM_POOL"        , 0);
+    useShapeKernels   = GetEnvVar("USE_SHAPE_KERNELS"   , 1);
     usePcieIndexing   = GetEnvVar("USE_PCIE_INDEX"      , 0);
     usePrepSrcKernel  = GetEnvVar("USE_PREP_KERNEL"     , 0);
     useSingleStream   = GetEnvVar("USE_SINGLE_STREAM"   , 1);
+    useWaveSubExec    = GetEnvVar("USE_WAVE_SUBEXEC"    , 0);
     useXccFilter      = GetEnvVar("USE_XCC_FILTER"      , 0);
     validateDirect    = GetEnvVar("VALIDATE_DIRECT"     , 0);
+    validateOnGpu     = GetEnvVar("VALIDATE_ON_GPU"     , 0);
     enableDebug       = GetEnvVar("DEBUG"               , 0);
     gpuKernel         = GetEnvVar("GPU_KERNEL"          , defaultGpuKernel);
 
@@ -216,30 +328,66 @@ public:
     sweepXgmiMin      = GetEnvVar("SWEEP_XGMI_MIN"      , 0);
     sweepXgmiMax      = GetEnvVar("SWEEP_XGMI_MAX"      , -1);
     sweepRandBytes    = GetEnvVar("SWEEP_RAND_BYTES"    , 0);
+    sweepPrioritize   = GetEnvVar("SWEEP_PRIORITIZE"    , 0);
+    sweepCheckpoint   = GetEnvVar("SWEEP_CHECKPOINT"    , "");
 
     // A2A Benchmark related
     a2aDirect         = GetEnvVar("A2A_DIRECT"          , 1);
 
+    // Collective Benchmark related
+    collChunkBytes    = GetEnvVar("COLL_CHUNK_BYTES"    , 0);
+
+    // Pipeline Benchmark related
+    pipelinePath       = GetEnvVar("PIPELINE_PATH"       , numGpuDevices > 1 ? "G0,C0,G1" : "G0,C0,G0");
+    pipelineChunkBytes = GetEnvVar("PIPELINE_CHUNK_BYTES", 1<<20);
+    pipelineDepth      = GetEnvVar("PIPELINE_DEPTH"      , 2);
+
+    // Contention Benchmark related
+    contentionAll      = GetEnvVar("CONTENTION_ALL"      , 0);
+
+    // Healthcheck related
+    hcExpectedFile     = GetEnvVar("HC_EXPECTED_FILE"    , "");
+    hcMinBw            = GetEnvVar("HC_MIN_BW"           , 0);
+    hcTimeLimit        = GetEnvVar("HC_TIME_LIMIT"       , 30);
+    hcTolerance        = GetEnvVar("HC_TOLERANCE"        , 15);
+
+    // Latency Benchmark related
+    latencyMode        = GetEnvVar("LATENCY_MODE"        , 0);
+    latencyRoundTrips  = GetEnvVar("LATENCY_ROUND_TRIPS" , 1000);
+    latencySteps       = GetEnvVar("LATENCY_STEPS"       , 10000);
+    latencyStride      = GetEnvVar("LATENCY_STRIDE"      , 128);
+
+    // Autotune related
+    autotuneFile       = GetEnvVar("AUTOTUNE_FILE"       , "autotune.cfg");
+
+    // Parse datatype
+    std::string dataTypeStr = GetEnvVar("DATA_TYPE", "fp32");
+    dataType = -1;
+    for (int i = 0; i < NUM_DATA_TYPES; i++)
+      if (dataTypeStr == DataTypeNames[i]) dataType = i;
+    if (dataType == -1)
+    {
+      InputError("Unrecognized DATA_TYPE [%s] (must be one of fp32, fp16, bf16, fp8, int32)", dataTypeStr.c_str());
+    }
+
     // Determine random seed
-    char *sweepSeedStr = getenv("SWEEP_SEED");
+    char const* sweepSeedStr = GetEnvStr("SWEEP_SEED");
     sweepSeed = (sweepSeedStr != NULL ? atoi(sweepSeedStr) : time(NULL));
     generator = new std::default_random_engine(sweepSeed);
 
     // Check for fill pattern
-    char* pattern = getenv("FILL_PATTERN");
+    char const* pattern = GetEnvStr("FILL_PATTERN");
     if (pattern != NULL)
     {
       if (usePrepSrcKernel)
       {
-        printf("[ERROR] Unable to use FILL_PATTERN and USE_PREP_KERNEL together\n");
-        exit(1);
+        InputError("Unable to use FILL_PATTERN and USE_PREP_KERNEL together");
       }
 
       int patternLen = strlen(pattern);
       if (patternLen % 2)
       {
-        printf("[ERROR] FILL_PATTERN must contain an even-number of hex digits\n");
-        exit(1);
+        InputError("FILL_PATTERN must contain an even-number of hex digits");
       }
 
       // Read in bytes
@@ -255,8 +403,7 @@ public:
           val += (pattern[i] - 'a' + 10);
         else
         {
-          printf("[ERROR] FILL_PATTERN must contain an even-number of hex digits (0-9'/a-f/A-F).  (not %c)\n", pattern[i]);
-          exit(1);
+          InputError("FILL_PATTERN must contain an even-number of hex digits (0-9'/a-f/A-F).  (not %c)", pattern[i]);
         }
 
         if (i % 2 == 0)
@@ -291,45 +438,64 @@ public:
 
     // Check for CU mask
     cuMask.clear();
-    char* cuMaskStr = getenv("CU_MASK");
+    char const* cuMaskStr = GetEnvStr("CU_MASK");
     if (cuMaskStr != NULL)
     {
 #if defined(__NVCC__)
       printf("[WARN] CU_MASK is not supported in CUDA\n");
 #else
-      std::vector<std::pair<int, int>> ranges;
-      int maxCU = 0;
-      char* token = strtok(cuMaskStr, ",");
+      ParseCuMask("CU_MASK", cuMaskStr, cuMask);
+#endif
+    }
+
+    // Check for background load CU mask
+    bgCuMask.clear();
+    char const* bgCuMaskStr = GetEnvStr("BG_CU_MASK");
+    if (bgCuMaskStr != NULL)
+    {
+#if defined(__NVCC__)
+      InputError("BG_CU_MASK is not supported in CUDA");
+#else
+      ParseCuMask("BG_CU_MASK", bgCuMaskStr, bgCuMask);
+#endif
+    }
+
+    // Check for collective ring order (defaults to GPUs in index order)
+    collRingOrder.clear();
+    char const* ringOrderStr = GetEnvStr("COLL_RING_ORDER");
+    if (ringOrderStr != NULL)
+    {
+      std::vector<bool> isUsed(numGpuDevices, false);
+      std::string tokenStr(ringOrderStr); // strtok modifies the string it parses
+      char* token = strtok(&tokenStr[0], ",");
       while (token)
       {
-        int start, end;
-        if (sscanf(token, "%d-%d", &start, &end) == 2)
-        {
-          ranges.push_back(std::make_pair(std::min(start, end), std::max(start, end)));
-          maxCU = std::max(maxCU, std::max(start, end));
-        }
-        else if (sscanf(token, "%d", &start) == 1)
+        int gpuIdx;
+        if (sscanf(token, "%d", &gpuIdx) != 1 || gpuIdx < 0 || gpuIdx >= numGpuDevices || isUsed[gpuIdx])
         {
-          ranges.push_back(std::make_pair(start, start));
-          maxCU = std::max(maxCU, start);
-        }
-        else
-        {
-          printf("[ERROR] Unrecognized token [%s]\n", token);
-          exit(1);
+          InputError("COLL_RING_ORDER must be a comma-separated list of unique GPU indices (invalid token [%s])", token);
         }
+        isUsed[gpuIdx] = true;
+        collRingOrder.push_back(gpuIdx);
         token = strtok(NULL, ",");
       }
-      cuMask.resize(maxCU / 32 + 1, 0);
-
-      for (auto range : ranges)
-      {
-        for (int i = range.first; i <= range.second; i++)
-        {
-          cuMask[i / 32] |= (1 << (i % 32));
-        }
-      }
-#endif
+    }
+    else
+    {
+      for (int i = 0; i < numGpuDevices; i++)
+        collRingOrder.push_back(i);
+    }
+    if (collChunkBytes < 0 || collChunkBytes % 4)
+    {
+      InputError("COLL_CHUNK_BYTES must be a non-negative multiple of 4");
+    }
+    if (pipelineChunkBytes <= 0 || pipelineChunkBytes % 4)
+    {
+      InputError("PIPELINE_CHUNK_BYTES must be a positive multiple of 4");
+    }
+    if (pipelineDepth < 1)
+    {
+      InputError("PIPELINE_DEPTH must be at least 1");
     }
 
     // Figure out number of xccs per device
@@ -357,10 +523,11 @@ public:
       prefXccTable[i].resize(numGpuDevices, 0);
     }
 
-    char* prefXccStr = getenv("XCC_PREF_TABLE");
+    char const* prefXccStr = GetEnvStr("XCC_PREF_TABLE");
     if (prefXccStr)
     {
-      char* token = strtok(prefXccStr, ",");
+      std::string tokenStr(prefXccStr); // strtok modifies the string it parses
+      char* token = strtok(&tokenStr[0], ",");
       int tokenCount = 0;
       while (token)
       {
@@ -371,8 +538,7 @@ public:
           int dst = tokenCount % numGpuDevices;
           if (xccIdsPerDevice[src].count(xccId) == 0)
           {
-            printf("[ERROR] GPU %d does not contain XCC %d\n", src, xccId);
-            exit(1);
+            InputError("GPU %d does not contain XCC %d", src, xccId);
           }
           prefXccTable[src][dst] = xccId;
 
@@ -381,8 +547,7 @@ public:
         }
         else
         {
-          printf("[ERROR] Unrecognized token [%s]\n", token);
-          exit(1);
+          InputError("Unrecognized token [%s]", token);
         }
         token = strtok(NULL, ",");
       }
@@ -391,77 +556,165 @@ public:
     // Perform some basic validation
     if (numCpuDevices > numDetectedCpus)
     {
-      printf("[ERROR] Number of CPUs to use (%d) cannot exceed number of detected CPUs (%d)\n", numCpuDevices, numDetectedCpus);
-      exit(1);
+      InputError("Number of CPUs to use (%d) cannot exceed number of detected CPUs (%d)", numCpuDevices, numDetectedCpus);
     }
     if (numGpuDevices > numDetectedGpus)
     {
-      printf("[ERROR] Number of GPUs to use (%d) cannot exceed number of detected GPUs (%d)\n", numGpuDevices, numDetectedGpus);
-      exit(1);
+      InputError("Number of GPUs to use (%d) cannot exceed number of detected GPUs (%d)", numGpuDevices, numDetectedGpus);
     }
     if (blockSize % 64)
     {
-      printf("[ERROR] BLOCK_SIZE (%d) must be a multiple of 64\n", blockSize);
-      exit(1);
+      InputError("BLOCK_SIZE (%d) must be a multiple of 64", blockSize);
     }
     if (blockSize > MAX_BLOCKSIZE)
     {
-      printf("[ERROR] BLOCK_SIZE (%d) must be less than %d\n", blockSize, MAX_BLOCKSIZE);
-      exit(1);
+      InputError("BLOCK_SIZE (%d) must be less than %d", blockSize, MAX_BLOCKSIZE);
     }
     if (byteOffset % sizeof(float))
     {
-      printf("[ERROR] BYTE_OFFSET must be set to multiple of %lu\n", sizeof(float));
-      exit(1);
+      InputError("BYTE_OFFSET must be set to multiple of %lu", sizeof(float));
     }
     if (blockOrder < 0 || blockOrder > 2)
     {
-      printf("[ERROR] BLOCK_ORDER must be 0 (Sequential), 1 (Interleaved), or 2 (Random)\n");
-      exit(1);
+      InputError("BLOCK_ORDER must be 0 (Sequential), 1 (Interleaved), or 2 (Random)");
+    }
+    if (hugePageSizeMb != 2 && hugePageSizeMb != 1024)
+    {
+      InputError("HUGE_PAGE_SIZE_MB must be either 2 (2MB pages) or 1024 (1GB pages)");
+    }
+    if (managedAdvice < 0 || managedAdvice > 3)
+    {
+      InputError("MANAGED_ADVICE must be 0 (None), 1 (Preferred location), 2 (Read mostly) or 3 (Coarse-grain)");
+    }
+#if defined(__NVCC__)
+    if (managedAdvice == 3)
+    {
+      InputError("MANAGED_ADVICE=3 (Coarse-grain) is not supported on NVIDIA platform");
+    }
+#endif
+    if (managedFirstTouch < 0 || managedFirstTouch > 1)
+    {
+      InputError("MANAGED_FIRST_TOUCH must be 0 (GPU) or 1 (CPU)");
+    }
+    if (managedPrefetch < 0 || managedPrefetch > 2)
+    {
+      InputError("MANAGED_PREFETCH must be 0 (None), 1 (GPU) or 2 (CPU)");
+    }
+    if (cpuCoreOffset < 0 || cpuCoreStride < 1)
+    {
+      InputError("CPU_CORE_OFFSET must be non-negative and CPU_CORE_STRIDE must be positive");
+    }
+    if (useHsaDma)
+    {
+#if defined(__NVCC__)
+      InputError("USE_HSA_DMA is not supported on NVIDIA platform");
+#endif
+      if (useAsyncLaunch || useHipGraph)
+      {
+        InputError("USE_HSA_DMA cannot be combined with USE_ASYNC_LAUNCH or USE_HIP_GRAPH");
+      }
+    }
+    if (useAsyncLaunch && numIterations <= 0)
+    {
+      InputError("USE_ASYNC_LAUNCH requires NUM_ITERATIONS to be set to a positive number");
+    }
+    if (baselineTolerance < 0 || baselineTolerance >= 100)
+    {
+      InputError("BASELINE_TOLERANCE must be between 0 and 99 (percent)");
+    }
+    if (baselineRetryIterations < 0)
+    {
+      InputError("BASELINE_RETRY_ITERS must be non-negative");
+    }
+    if (hcMinBw < 0)
+    {
+      InputError("HC_MIN_BW must be non-negative");
+    }
+    if (hcTimeLimit < 0)
+    {
+      InputError("HC_TIME_LIMIT must be non-negative");
+    }
+    if (hcTolerance < 0 || hcTolerance >= 100)
+    {
+      InputError("HC_TOLERANCE must be between 0 and 99 (percent)");
+    }
+    if (!gpuCounters.empty())
+    {
+#if !defined(TB_ENABLE_ROCPROFILER)
+      InputError("GPU_COUNTERS requires TransferBench to be built with rocprofiler-sdk support (ENABLE_ROCPROFILER)");
+#endif
+      if (useAsyncLaunch || useHipGraph)
+      {
+        InputError("GPU_COUNTERS is not supported with USE_ASYNC_LAUNCH or USE_HIP_GRAPH");
+      }
+    }
+    if (latencyMode < 0 || latencyMode > 2)
+    {
+      InputError("LATENCY_MODE must be 0 (both), 1 (pointer-chase) or 2 (ping-pong)");
+    }
+    if (latencyRoundTrips <= 0 || latencySteps <= 0)
+    {
+      InputError("LATENCY_ROUND_TRIPS and LATENCY_STEPS must be positive");
+    }
+    if (latencyStride < 4 || latencyStride % 4)
+    {
+      InputError("LATENCY_STRIDE must be a positive multiple of 4 bytes");
+    }
+    if (sampleWindowMs < 0)
+    {
+      InputError("SAMPLE_WINDOW_MS must be non-negative");
     }
     if (numWarmups < 0)
     {
-      printf("[ERROR] NUM_WARMUPS must be set to a non-negative number\n");
-      exit(1);
+      InputError("NUM_WARMUPS must be set to a non-negative number");
     }
     if (samplingFactor < 1)
     {
-      printf("[ERROR] SAMPLING_FACTOR must be greater or equal to 1\n");
-      exit(1);
+      InputError("SAMPLING_FACTOR must be greater or equal to 1");
     }
     if (sharedMemBytes < 0 || sharedMemBytes > maxSharedMemBytes)
     {
-      printf("[ERROR] SHARED_MEM_BYTES must be between 0 and %d\n", maxSharedMemBytes);
-      exit(1);
+      InputError("SHARED_MEM_BYTES must be between 0 and %d", maxSharedMemBytes);
+    }
+    if (bgLoad < 0 || bgLoad > 2)
+    {
+      InputError("BG_LOAD must be 0 (none), 1 (compute) or 2 (memory)");
+    }
+    if (bgNumBlocks < 0)
+    {
+      InputError("BG_NUM_BLOCKS must be non-negative");
+    }
+    if (bgLoad == 2 && (bgBytes <= 0 || bgBytes % 16))
+    {
+      InputError("BG_BYTES must be a positive multiple of 16");
+    }
+    if (stealChunkBytes <= 0 || stealChunkBytes % 16)
+    {
+      InputError("STEAL_CHUNK_BYTES must be a positive multiple of 16");
     }
     if (blockBytes <= 0 || blockBytes % 4)
     {
-      printf("[ERROR] BLOCK_BYTES must be a positive multiple of 4\n");
-      exit(1);
+      InputError("BLOCK_BYTES must be a positive multiple of 4");
     }
     if (numGpuSubExecs <= 0)
     {
-      printf("[ERROR] NUM_GPU_SE must be greater than 0\n");
-      exit(1);
+      InputError("NUM_GPU_SE must be greater than 0");
     }
 
     if (numCpuSubExecs <= 0)
     {
-      printf("[ERROR] NUM_CPU_SE must be greater than 0\n");
-      exit(1);
+      InputError("NUM_CPU_SE must be greater than 0");
     }
 
     for (auto ch : sweepSrc)
     {
       if (!strchr(MemTypeStr, ch))
       {
-        printf("[ERROR] Unrecognized memory type '%c' specified for sweep source\n", ch);
-        exit(1);
+        InputError("Unrecognized memory type '%c' specified for sweep source", ch);
       }
       if (strchr(sweepSrc.c_str(), ch) != strrchr(sweepSrc.c_str(), ch))
       {
-        printf("[ERROR] Duplicate memory type '%c' specified for sweep source\n", ch);
-        exit(1);
+        InputError("Duplicate memory type '%c' specified for sweep source", ch);
       }
     }
 
@@ -469,13 +722,11 @@ public:
     {
       if (!strchr(MemTypeStr, ch))
       {
-        printf("[ERROR] Unrecognized memory type '%c' specified for sweep destination\n", ch);
-        exit(1);
+        InputError("Unrecognized memory type '%c' specified for sweep destination", ch);
       }
       if (strchr(sweepDst.c_str(), ch) != strrchr(sweepDst.c_str(), ch))
       {
-        printf("[ERROR] Duplicate memory type '%c' specified for sweep destination\n", ch);
-        exit(1);
+        InputError("Duplicate memory type '%c' specified for sweep destination", ch);
       }
     }
 
@@ -483,20 +734,38 @@ public:
     {
       if (!strchr(ExeTypeStr, ch))
       {
-        printf("[ERROR] Unrecognized executor type '%c' specified for sweep executor\n", ch);
-        exit(1);
+        InputError("Unrecognized executor type '%c' specified for sweep executor", ch);
       }
       if (strchr(sweepExe.c_str(), ch) != strrchr(sweepExe.c_str(), ch))
       {
-        printf("[ERROR] Duplicate executor type '%c' specified for sweep executor\n", ch);
-        exit(1);
+        InputError("Duplicate executor type '%c' specified for sweep executor", ch);
       }
     }
+    if (cpuKernel < 0 || cpuKernel >= NUM_CPU_KERNELS)
+    {
+      InputError("CPU kernel must be between 0 and %d", NUM_CPU_KERNELS - 1);
+    }
+    if (!IsCpuKernelSupported(cpuKernel))
+    {
+      InputError("CPU kernel %d [%s] is not supported by this CPU", cpuKernel, CpuKernelNames[cpuKernel].c_str());
+    }
     if (gpuKernel < 0 || gpuKernel > NUM_GPU_KERNELS)
     {
-      printf("[ERROR] GPU kernel must be between 0 and %d\n", NUM_GPU_KERNELS);
-      exit(1);
+      InputError("GPU kernel must be between 0 and %d", NUM_GPU_KERNELS);
+    }
+    if (useWaveSubExec && (gpuKernel == GPU_KERNEL_UNROLL_B || gpuKernel == GPU_KERNEL_STEAL))
+    {
+      InputError("GPU kernel %d [%s] does not support USE_WAVE_SUBEXEC", gpuKernel, GpuKernelNames[gpuKernel].c_str());
+    }
+    if (dataType != DATA_FP32 && gpuKernel == GPU_KERNEL_UNROLL_B)
+    {
+      InputError("GPU kernel %d [%s] only supports fp32", gpuKernel, GpuKernelNames[gpuKernel].c_str());
+    }
+    if (dataType != DATA_FP32 && cpuKernel != 0)
+    {
+      InputError("CPU_KERNEL must be 0 when DATA_TYPE is not fp32");
     }
+    nativeAccum = (nativeAccum ? 1 : 0);
 
     // Determine how many CPUs exit per NUMA node (to avoid executing on NUMA without CPUs)
     numCpusPerNuma.resize(numDetectedCpus);
@@ -525,10 +794,9 @@ public:
     }
 
     // Check for deprecated env vars
-    if (getenv("USE_HIP_CALL"))
+    if (GetEnvStr("USE_HIP_CALL"))
     {
-      printf("[WARN] USE_HIP_CALL has been deprecated.  Please use DMA executor 'D' or set USE_GPU_DMA for P2P-Benchmark preset\n");
-      exit(1);
+      InputError("USE_HIP_CALL has been deprecated.  Please use DMA executor 'D' or set USE_GPU_DMA for P2P-Benchmark preset");
     }
 
     char* enableSdma = getenv("HSA_ENABLE_SDMA");
@@ -544,36 +812,78 @@ public:
     printf("Environment variables:\n");
     printf("======================\n");
     printf(" ALWAYS_VALIDATE        - Validate after each iteration instead of once after all iterations\n");
+    printf(" AUTOTUNE_FILE          - Tuning table written by autotune preset / read for \"auto\" #SEs. Defaults to autotune.cfg\n");
+    printf(" BASELINE_FILE          - Compare bandwidth of each Transfer against a RESULTS_FILE from a previous run\n");
+    printf(" BASELINE_RETRY_ITERS=I - Re-run Tests that regress against the baseline with I iterations to confirm\n");
+    printf(" BASELINE_TOLERANCE=P   - Flag Transfers more than P percent slower than the baseline. Defaults to 10\n");
+    printf(" BG_BYTES=B             - Size of each buffer streamed by the memory-bound background load. Defaults to 256MB\n");
+    printf(" BG_CU_MASK             - CUs the background load may run on (same format as CU_MASK). Defaults to all CUs\n");
+    printf(" BG_LOAD=L              - Run a background load on each GPU executor's device during each Test (0=None, 1=Compute (FMA), 2=Memory (copy))\n");
+    printf(" BG_NUM_BLOCKS=B        - # of persistent threadblocks used by the background load. Defaults to one per CU\n");
     printf(" BLOCK_SIZE             - # of threads per threadblock (Must be multiple of 64). Defaults to 256\n");
     printf(" BLOCK_BYTES            - Each CU (except the last) receives a multiple of BLOCK_BYTES to copy\n");
     printf(" BLOCK_ORDER            - Threadblock ordering in single-stream mode (0=Serial, 1=Interleaved, 2=Random)\n");
     printf(" BYTE_OFFSET            - Initial byte-offset for memory allocations.  Must be multiple of 4. Defaults to 0\n");
     printf(" CONTINUE_ON_ERROR      - Continue tests even after mismatch detected\n");
+    printf(" CPU_CORE_OFFSET=C      - Pin first CPU worker thread to the C-th core of its NUMA node\n");
+    printf(" CPU_CORE_STRIDE=S      - Pin consecutive CPU worker threads S cores apart (e.g. to spread across L3 domains)\n");
+    printf(" CPU_KERNEL=K           - Select CPU executor kernel:\n");
+    for (int i = 0; i < NUM_CPU_KERNELS; i++)
+      printf("                          %d: %s\n", i, CpuKernelNames[i].c_str());
     printf(" CU_MASK                - CU mask for streams specified in hex digits (0-0,a-f,A-F)\n");
+    printf(" DATA_TYPE=STR          - Element datatype for reductions (fp32, fp16, bf16, fp8, int32). Defaults to fp32\n");
     printf(" FILL_PATTERN=STR       - Fill input buffer with pattern specified in hex digits (0-9,a-f,A-F).  Must be even number of digits, (byte-level big-endian)\n");
+    printf(" GPU_COUNTERS=LIST      - Comma-separated hardware counters to report per GFX Transfer (e.g. TCC_HIT_sum,TCC_MISS_sum)\n");
+    printf("                          Requires building with ENABLE_ROCPROFILER\n");
     printf(" HIDE_ENV               - Hide environment variable value listing\n");
+    printf(" HUGE_PAGE_SIZE_MB=S    - Size of huge pages used for huge-page host memory (2 or 1024). Defaults to 2\n");
+    printf(" MANAGED_ADVICE=A       - Advice for managed memory (0=None, 1=Preferred location on its GPU, 2=Read mostly, 3=Coarse-grain)\n");
+    printf(" MANAGED_FIRST_TOUCH=T  - Where managed memory is first touched after allocation (0=its GPU, 1=CPU)\n");
+    printf(" MANAGED_PREFETCH=P     - Prefetch managed memory before the first iteration (0=None, 1=to its GPU, 2=to CPU)\n");
+    printf(" NATIVE_ACCUMULATE      - Accumulate reductions in the element datatype instead of fp32 (rounding after every addition)\n");
     printf(" NUM_CPU_DEVICES=X      - Restrict number of CPUs to X.  May not be greater than # detected NUMA nodes\n");
     printf(" NUM_GPU_DEVICES=X      - Restrict number of GPUs to X.  May not be greater than # detected HIP devices\n");
     printf(" NUM_ITERATIONS=I       - Perform I timed iteration(s) per test\n");
     printf(" NUM_WARMUPS=W          - Perform W untimed warmup iteration(s) per test\n");
     printf(" OUTPUT_TO_CSV          - Outputs to CSV format if set\n");
+    printf(" RESULTS_FILE           - Stream results of all Tests / presets to this file as JSON lines (versioned schema)\n");
+    printf(" SAMPLE_FILE            - Also write sampling windows to this file as CSV\n");
+    printf(" SAMPLE_GPU_STATS       - Include GPU clock (MHz) and power (W) of the executing GPU in each sampling window\n");
+    printf(" SAMPLE_WINDOW_MS=X     - Report bandwidth per Transfer for every X milliseconds of timed iterations\n");
     printf(" SAMPLING_FACTOR=F      - Add F samples (when possible) between powers of 2 when auto-generating data sizes\n");
     printf(" SHARED_MEM_BYTES=X     - Use X shared mem bytes per threadblock, potentially to avoid multiple threadblocks per CU\n");
     printf(" SHOW_ITERATIONS        - Show per-iteration timing info\n");
+    printf(" SHOW_PERCENTILES       - Show p50/p90/p99/p99.9/max/stddev of per-iteration timing per Transfer and executor\n");
+    printf(" STEAL_CHUNK_BYTES=X    - Threadblocks of the work-stealing GPU kernel (GPU_KERNEL=%d) claim X bytes at a time\n", GPU_KERNEL_STEAL);
+    printf(" USE_ASYNC_LAUNCH       - Enqueue iterations back-to-back, synchronizing once per batch of %d (requires NUM_ITERATIONS > 0)\n", MAX_ASYNC_PARAM_SLICES);
+    printf(" USE_HIP_GRAPH          - Capture GPU executor launches into HIP graphs and replay them each iteration\n");
+    printf(" USE_HSA_DMA            - Run DMA executor copies via HSA on explicit SDMA engines (D<gpu>.<engine>), striped across #SEs engines\n");
+    printf(" USE_CPU_THREAD_POOL    - Use persistent core-pinned worker threads for CPU executors instead of spawning threads per iteration\n");
     printf(" USE_INTERACTIVE        - Pause for user-input before starting transfer loop\n");
+    printf(" USE_MEM_POOL           - Keep memory allocations and streams alive across Tests for re-use (always on for sweeps)\n");
     printf(" USE_PCIE_INDEX         - Index GPUs by PCIe address-ordering instead of HIP-provided indexing\n");
     printf(" USE_PREP_KERNEL        - Use GPU kernel to initialize source data array pattern\n");
+    printf(" USE_SHAPE_KERNELS      - Use GPU kernels specialized for 1->1, 2->1, 1->2, 4->1, 8->1 Transfers with the default unroll (default). Set to 0 to disable\n");
     printf(" USE_SINGLE_STREAM      - Use a single stream per GPU GFX executor instead of stream per Transfer\n");
+    printf(" USE_WAVE_SUBEXEC       - GFX subExecutors are wavefronts (packed BLOCK_SIZE/%d per threadblock) instead of threadblocks\n", WARP_SIZE);
     printf(" USE_XCC_FILTER         - Use XCC filtering (experimental)\n");
     printf(" VALIDATE_DIRECT        - Validate GPU destination memory directly instead of staging GPU memory on host\n");
+    printf(" VALIDATE_ON_GPU        - Validate GPU memory in place with a GPU kernel instead of comparing on the host\n");
   }
 
   // Helper macro to switch between CSV and terminal output
-#define PRINT_EV(NAME, VALUE, DESCRIPTION)                              \
-  printf("%-20s%s%12d%s%s\n", NAME, outputToCsv ? "," : " = ", VALUE, outputToCsv ? "," : " : ",  (DESCRIPTION).c_str())
-
-#define PRINT_ES(NAME, VALUE, DESCRIPTION)                           \
-  printf("%-20s%s%12s%s%s\n", NAME, outputToCsv ? "," : " = ", VALUE, outputToCsv ? "," : " : ",  (DESCRIPTION).c_str())
+// Displayed env vars are also recorded in the header of the results file
+#define PRINT_EV(NAME, VALUE, DESCRIPTION)                                                                             \
+  do {                                                                                                                 \
+    printf("%-20s%s%12d%s%s\n", NAME, outputToCsv ? "," : " = ", VALUE, outputToCsv ? "," : " : ",  (DESCRIPTION).c_str()); \
+    ResultsSink::Get().AddEnvVar(NAME, VALUE);                                                                         \
+  } while (0)
+
+#define PRINT_ES(NAME, VALUE, DESCRIPTION)                                                                             \
+  do {                                                                                                                 \
+    printf("%-20s%s%12s%s%s\n", NAME, outputToCsv ? "," : " = ", VALUE, outputToCsv ? "," : " : ",  (DESCRIPTION).c_str()); \
+    ResultsSink::Get().AddEnvVar(NAME, VALUE);                                                                         \
+  } while (0)
 
   // Display env var settings
   void DisplayEnvVars() const
@@ -589,6 +899,23 @@ public:
     if (hideEnv) return;
     PRINT_EV("ALWAYS_VALIDATE", alwaysValidate,
              std::string("Validating after ") + (alwaysValidate ? "each iteration" : "all iterations"));
+    PRINT_ES("BASELINE_FILE", baselineFile.empty() ? "(none)" : baselineFile.c_str(),
+             std::string(baselineFile.empty() ? "Not comparing" : "Comparing") + " results against a baseline");
+    PRINT_EV("BASELINE_RETRY_ITERS", baselineRetryIterations,
+             baselineRetryIterations ? std::string("Re-running regressed Tests with ") + std::to_string(baselineRetryIterations) + " iterations"
+                                     : std::string("Not re-running regressed Tests"));
+    PRINT_EV("BASELINE_TOLERANCE", baselineTolerance,
+             std::string("Flagging Transfers more than ") + std::to_string(baselineTolerance) + "% below baseline");
+    PRINT_EV("BG_BYTES", bgBytes,
+             std::string(bgLoad == 2 ? "Background load streams " + std::to_string(bgBytes) + " bytes per pass" : "Unused"));
+    PRINT_EV("BG_CU_MASK", GetEnvStr("BG_CU_MASK") ? 1 : 0,
+             (bgCuMask.size() ? GetCuMaskDesc(bgCuMask) : "All"));
+    PRINT_EV("BG_LOAD", bgLoad,
+             std::string(bgLoad == 0 ? "No background load" :
+                         bgLoad == 1 ? "Running compute-bound (FMA) background load" :
+                                       "Running memory-bound (copy) background load"));
+    PRINT_EV("BG_NUM_BLOCKS", bgNumBlocks,
+             std::string(bgNumBlocks ? std::to_string(bgNumBlocks) + " background threadblocks" : "One background threadblock per CU"));
     PRINT_EV("BLOCK_SIZE", blockSize,
              std::string("Threadblock size of " + std::to_string(blockSize)));
     PRINT_EV("BLOCK_BYTES", blockBytes,
@@ -601,12 +928,35 @@ public:
              std::string("Using byte offset of " + std::to_string(byteOffset)));
     PRINT_EV("CONTINUE_ON_ERROR", continueOnError,
              std::string(continueOnError ? "Continue on mismatch error" : "Stop after first error"));
-    PRINT_EV("CU_MASK", getenv("CU_MASK") ? 1 : 0,
+    PRINT_EV("CPU_CORE_OFFSET", cpuCoreOffset,
+             std::string("First CPU worker pinned to core offset " + std::to_string(cpuCoreOffset) + " within NUMA node"));
+    PRINT_EV("CPU_CORE_STRIDE", cpuCoreStride,
+             std::string("CPU workers pinned " + std::to_string(cpuCoreStride) + " core(s) apart"));
+    PRINT_EV("CPU_KERNEL", cpuKernel,
+             std::string("Using CPU kernel ") + std::to_string(cpuKernel) + " [" + CpuKernelNames[cpuKernel] + "]");
+    PRINT_EV("CU_MASK", GetEnvStr("CU_MASK") ? 1 : 0,
              (cuMask.size() ? GetCuMaskDesc() : "All"));
-    PRINT_EV("FILL_PATTERN", getenv("FILL_PATTERN") ? 1 : 0,
-             (fillPattern.size() ? std::string(getenv("FILL_PATTERN")) : PrepSrcValueString()));
+    PRINT_EV("DATA_TYPE", dataType,
+             std::string("Reducing ") + DataTypeNames[dataType] + " elements");
+    PRINT_EV("FILL_PATTERN", GetEnvStr("FILL_PATTERN") ? 1 : 0,
+             (fillPattern.size() ? std::string(GetEnvStr("FILL_PATTERN")) : PrepSrcValueString()));
+    PRINT_ES("GPU_COUNTERS", gpuCounters.empty() ? "(none)" : gpuCounters.c_str(),
+             std::string(gpuCounters.empty() ? "Not collecting" : "Collecting") + " hardware counters per GFX Transfer");
     PRINT_EV("GPU_KERNEL", gpuKernel,
              std::string("Using GPU kernel ") + std::to_string(gpuKernel) + " [" + std::string(GpuKernelNames[gpuKernel]) + "]");
+    PRINT_EV("HUGE_PAGE_SIZE_MB", hugePageSizeMb,
+             std::string("Huge-page host memory uses ") + (hugePageSizeMb == 2 ? "2MB" : "1GB") + " pages");
+    PRINT_EV("MANAGED_ADVICE", managedAdvice,
+             std::string("Managed memory advice: ") + (managedAdvice == 0 ? "None"               :
+                                                       managedAdvice == 1 ? "Preferred location" :
+                                                       managedAdvice == 2 ? "Read mostly"        : "Coarse-grain"));
+    PRINT_EV("MANAGED_FIRST_TOUCH", managedFirstTouch,
+             std::string("Managed memory first touched by ") + (managedFirstTouch ? "CPU" : "GPU"));
+    PRINT_EV("MANAGED_PREFETCH", managedPrefetch,
+             std::string("Managed memory ") + (managedPrefetch == 0 ? "not prefetched" :
+                                               managedPrefetch == 1 ? "prefetched to GPU" : "prefetched to CPU"));
+    PRINT_EV("NATIVE_ACCUMULATE", nativeAccum,
+             std::string("Accumulating in ") + (nativeAccum ? DataTypeNames[dataType] : (dataType == DATA_INT32 ? "int32" : "fp32")));
     PRINT_EV("NUM_CPU_DEVICES", numCpuDevices,
              std::string("Using ") + std::to_string(numCpuDevices) + " CPU devices");
     PRINT_EV("NUM_GPU_DEVICES", numGpuDevices,
@@ -616,18 +966,47 @@ public:
              + (numIterations > 0 ? " timed iteration(s)" : "seconds(s) per Test"));
     PRINT_EV("NUM_WARMUPS", numWarmups,
              std::string("Running " + std::to_string(numWarmups) + " warmup iteration(s) per Test"));
+    PRINT_ES("RESULTS_FILE", resultsFile.empty() ? "(none)" : resultsFile.c_str(),
+             std::string(resultsFile.empty() ? "Not writing" : "Writing") + " structured results as JSON lines");
+    PRINT_ES("SAMPLE_FILE", sampleFile.empty() ? "(none)" : sampleFile.c_str(),
+             std::string(sampleFile.empty() ? "Not writing sampling windows to file" : "Writing sampling windows to " + sampleFile));
+    PRINT_EV("SAMPLE_GPU_STATS", sampleGpuStats,
+             std::string(sampleGpuStats ? "Reporting" : "Not reporting") + " GPU clock / power per sampling window");
+    PRINT_EV("SAMPLE_WINDOW_MS", sampleWindowMs,
+             sampleWindowMs ? std::string("Sampling bandwidth every ") + std::to_string(sampleWindowMs) + " ms"
+                            : std::string("Sliding-window sampling disabled"));
     PRINT_EV("SHARED_MEM_BYTES", sharedMemBytes,
              std::string("Using " + std::to_string(sharedMemBytes) + " shared mem per threadblock"));
     PRINT_EV("SHOW_ITERATIONS", showIterations,
              std::string(showIterations ? "Showing" : "Hiding") + " per-iteration timing");
+    PRINT_EV("SHOW_PERCENTILES", showPercentiles,
+             std::string(showPercentiles ? "Showing" : "Hiding") + " per-iteration latency percentiles");
+    PRINT_EV("STEAL_CHUNK_BYTES", stealChunkBytes,
+             std::string(gpuKernel == GPU_KERNEL_STEAL ? "Threadblocks claim " + std::to_string(stealChunkBytes) + " bytes at a time"
+                                                       : "Unused (static partitioning)"));
+    PRINT_EV("USE_ASYNC_LAUNCH", useAsyncLaunch,
+             std::string(useAsyncLaunch ? "Enqueuing up to " + std::to_string(MAX_ASYNC_PARAM_SLICES) + " iterations before synchronizing"
+                                        : "Synchronizing after every iteration"));
+    PRINT_EV("USE_HIP_GRAPH", useHipGraph,
+             std::string(useHipGraph ? "Replaying captured graphs" : "Launching directly") + " for GPU executors");
+    PRINT_EV("USE_HSA_DMA", useHsaDma,
+             std::string(useHsaDma ? "Copying on explicit SDMA engines via HSA" : "Copying via hipMemcpyAsync") + " for DMA executors");
+    PRINT_EV("USE_CPU_THREAD_POOL", useCpuThreadPool,
+             std::string(useCpuThreadPool ? "Using persistent pinned" : "Spawning new") + " CPU worker threads");
     PRINT_EV("USE_INTERACTIVE", useInteractive,
              std::string("Running in ") + (useInteractive ? "interactive" : "non-interactive") + " mode");
+    PRINT_EV("USE_MEM_POOL", useMemPool,
+             std::string(useMemPool ? "Re-using" : "Re-allocating") + " memory and streams across Tests");
     PRINT_EV("USE_PCIE_INDEX", usePcieIndexing,
              std::string("Use ") + (usePcieIndexing ? "PCIe" : "HIP") + " GPU device indexing");
     PRINT_EV("USE_PREP_KERNEL", usePrepSrcKernel,
              std::string("Using ") + (usePrepSrcKernel ? "GPU kernels" : "hipMemcpy") + " to initialize source data");
+    PRINT_EV("USE_SHAPE_KERNELS", useShapeKernels,
+             std::string(useShapeKernels ? "Using shape-specialized" : "Using generic") + " GPU kernels for common Transfer shapes");
     PRINT_EV("USE_SINGLE_STREAM", useSingleStream,
              std::string("Using single stream per ") + (useSingleStream ? "device" : "Transfer"));
+    PRINT_EV("USE_WAVE_SUBEXEC", useWaveSubExec,
+             std::string("GFX subExecutors are ") + (useWaveSubExec ? "wavefronts" : "threadblocks"));
     PRINT_EV("USE_XCC_FILTER", useXccFilter,
              std::string("XCC filtering ") + (useXccFilter ? "enabled" : "disabled"));
     if (useXccFilter)
@@ -645,6 +1024,8 @@ public:
     }
     PRINT_EV("VALIDATE_DIRECT", validateDirect,
              std::string("Validate GPU destination memory ") + (validateDirect ? "directly" : "via CPU staging buffer"));
+    PRINT_EV("VALIDATE_ON_GPU", validateOnGpu,
+             std::string("Validate GPU memory ") + (validateOnGpu ? "in place via GPU kernel" : "on the host"));
     printf("\n");
 
     if (blockOrder != ORDER_SEQUENTIAL && !useSingleStream)
@@ -687,6 +1068,8 @@ public:
 
     if (!outputToCsv)
       printf("[Sweep Related]\n");
+    PRINT_ES("SWEEP_CHECKPOINT", sweepCheckpoint.empty() ? "(none)" : sweepCheckpoint.c_str(),
+             std::string(sweepCheckpoint.empty() ? "Not checkpointing sweep" : "Recording / resuming completed tests"));
     PRINT_ES("SWEEP_DST", sweepDst.c_str(),
              std::string("Destination Memory Types to sweep"));
     PRINT_ES("SWEEP_EXE", sweepExe.c_str(),
@@ -695,6 +1078,8 @@ public:
              std::string("Max simultaneous transfers (0 = no limit)"));
     PRINT_EV("SWEEP_MIN", sweepMin,
              std::string("Min simultaenous transfers"));
+    PRINT_EV("SWEEP_PRIORITIZE", sweepPrioritize,
+             std::string(sweepPrioritize ? "Testing most contended combinations first" : "Testing combinations in order"));
     PRINT_EV("SWEEP_RAND_BYTES", sweepRandBytes,
              std::string("Using ") + (sweepRandBytes ? "random" : "constant") + " number of bytes per Transfer");
     PRINT_EV("SWEEP_SEED", sweepSeed,
@@ -728,33 +1113,202 @@ public:
     printf("\n");
   }
 
+  void DisplayCollEnvVars() const
+  {
+    DisplayEnvVars();
+    if (hideEnv) return;
+    if (!outputToCsv)
+      printf("[Collective Related]\n");
+    PRINT_EV("COLL_CHUNK_BYTES", collChunkBytes,
+             collChunkBytes ? std::string("Sending at most ") + std::to_string(collChunkBytes) + " bytes per Transfer per step"
+                            : std::string("Sending each step's data as a single chunk"));
+    std::string ringOrderStr;
+    for (int i = 0; i < collRingOrder.size(); i++)
+      ringOrderStr += (i ? "," : "") + std::to_string(collRingOrder[i]);
+    PRINT_ES("COLL_RING_ORDER", ringOrderStr.c_str(),
+             std::string("Order of GPUs in ring / tree"));
+    PRINT_EV("USE_FINE_GRAIN", useFineGrain,
+             std::string("Using ") + (useFineGrain ? "fine" : "coarse") + "-grained memory");
+    PRINT_EV("USE_REMOTE_READ", useRemoteRead,
+             std::string("Using ") + (useRemoteRead ? "DST" : "SRC") + " as executor");
+
+    printf("\n");
+  }
+
+  void DisplayContentionEnvVars() const
+  {
+    DisplayEnvVars();
+    if (hideEnv) return;
+    if (!outputToCsv)
+      printf("[Contention Related]\n");
+    PRINT_EV("CONTENTION_ALL", contentionAll,
+             std::string(contentionAll ? "Measuring all pairs of flows" : "Skipping flows on separate direct XGMI links"));
+    PRINT_EV("NUM_GPU_SE", numGpuSubExecs,
+             std::string("Using ") + std::to_string(numGpuSubExecs) + " GPU subexecutors");
+    PRINT_EV("USE_FINE_GRAIN", useFineGrain,
+             std::string("Using ") + (useFineGrain ? "fine" : "coarse") + "-grained memory");
+    PRINT_EV("USE_GPU_DMA", useDmaCopy,
+             std::string("Using GPU-") + (useDmaCopy ? "DMA" : "GFX") + " as GPU executor");
+    PRINT_EV("USE_REMOTE_READ", useRemoteRead,
+             std::string("Using ") + (useRemoteRead ? "DST" : "SRC") + " as executor");
+
+    printf("\n");
+  }
+
+  void DisplayAutotuneEnvVars() const
+  {
+    DisplayEnvVars();
+    if (hideEnv) return;
+    if (!outputToCsv)
+      printf("[Autotune Related]\n");
+    PRINT_ES("AUTOTUNE_FILE", autotuneFile.c_str(),
+             std::string("Writing tuning table to ") + autotuneFile);
+    PRINT_EV("USE_REMOTE_READ", useRemoteRead,
+             std::string("Using ") + (useRemoteRead ? "DST" : "SRC") + " as executor");
+
+    printf("\n");
+  }
+
+  void DisplayHealthcheckEnvVars() const
+  {
+    DisplayEnvVars();
+    if (hideEnv) return;
+    if (!outputToCsv)
+      printf("[Healthcheck Related]\n");
+    PRINT_ES("HC_EXPECTED_FILE", hcExpectedFile.empty() ? "(none)" : hcExpectedFile.c_str(),
+             hcExpectedFile.empty() ? std::string("Expecting the median bandwidth of each link class")
+                                    : std::string("Reading expected bandwidth per link class from ") + hcExpectedFile);
+    PRINT_EV("HC_MIN_BW", hcMinBw,
+             hcMinBw ? std::string("Failing links below ") + std::to_string(hcMinBw) + " GB/s"
+                     : std::string("No absolute bandwidth floor"));
+    PRINT_EV("HC_TIME_LIMIT", hcTimeLimit,
+             hcTimeLimit ? std::string("Completing health check within ") + std::to_string(hcTimeLimit) + " seconds"
+                         : std::string("No time limit"));
+    PRINT_EV("HC_TOLERANCE", hcTolerance,
+             std::string("Failing links more than ") + std::to_string(hcTolerance) + "% below expected bandwidth");
+    PRINT_EV("NUM_GPU_SE", numGpuSubExecs,
+             std::string("Using ") + std::to_string(numGpuSubExecs) + " GPU subexecutors");
+    PRINT_EV("USE_FINE_GRAIN", useFineGrain,
+             std::string("Using ") + (useFineGrain ? "fine" : "coarse") + "-grained memory");
+
+    printf("\n");
+  }
+
+  void DisplayLatencyEnvVars() const
+  {
+    DisplayEnvVars();
+    if (hideEnv) return;
+    if (!outputToCsv)
+      printf("[Latency Related]\n");
+    PRINT_EV("LATENCY_MODE", latencyMode,
+             std::string("Running ") + (latencyMode == 1 ? "pointer-chase" :
+                                        latencyMode == 2 ? "ping-pong"     :
+                                                           "pointer-chase and ping-pong"));
+    PRINT_EV("LATENCY_ROUND_TRIPS", latencyRoundTrips,
+             std::to_string(latencyRoundTrips) + " flag round trips per ping-pong measurement");
+    PRINT_EV("LATENCY_STEPS", latencySteps,
+             std::to_string(latencySteps) + " dependent loads per pointer-chase measurement");
+    PRINT_EV("LATENCY_STRIDE", latencyStride,
+             std::string("Pointer-chase elements are ") + std::to_string(latencyStride) + " bytes apart");
+    PRINT_EV("USE_FINE_GRAIN", useFineGrain,
+             std::string("Pointer-chase over ") + (useFineGrain ? "fine" : "coarse") + "-grained memory");
+
+    printf("\n");
+  }
+
+  void DisplayPipelineEnvVars() const
+  {
+    DisplayEnvVars();
+    if (hideEnv) return;
+    if (!outputToCsv)
+      printf("[Pipeline Related]\n");
+    PRINT_ES("PIPELINE_PATH", pipelinePath.c_str(),
+             std::string("Memory locations each chunk is forwarded through"));
+    PRINT_EV("PIPELINE_CHUNK_BYTES", pipelineChunkBytes,
+             std::string("Splitting buffer into chunks of ") + std::to_string(pipelineChunkBytes) + " bytes");
+    PRINT_EV("PIPELINE_DEPTH", pipelineDepth,
+             std::string("Keeping up to ") + std::to_string(pipelineDepth) + " chunk(s) in flight per hop");
+
+    printf("\n");
+  }
+
+  // Returns the value of a variable (or NULL if not set) from the settings of this EnvVars
+  char const* GetEnvStr(std::string const& varname) const
+  {
+    auto it = settings.values.find(varname);
+    if (it != settings.values.end()) return it->second.c_str();
+    return settings.useProcessEnv ? getenv(varname.c_str()) : NULL;
+  }
+
   // Helper function that gets parses environment variable or sets to default value
-  static int GetEnvVar(std::string const& varname, int defaultValue)
+  int GetEnvVar(std::string const& varname, int defaultValue) const
   {
-    if (getenv(varname.c_str()))
-      return atoi(getenv(varname.c_str()));
+    if (GetEnvStr(varname))
+      return atoi(GetEnvStr(varname));
     return defaultValue;
   }
 
-  static std::string GetEnvVar(std::string const& varname, std::string const& defaultValue)
+  std::string GetEnvVar(std::string const& varname, std::string const& defaultValue) const
   {
-    if (getenv(varname.c_str()))
-      return getenv(varname.c_str());
+    if (GetEnvStr(varname))
+      return GetEnvStr(varname);
     return defaultValue;
   }
 
+  // Parse a comma-separated list of CUs / CU ranges (e.g. "0-3,8") into a bit-vector
+  static void ParseCuMask(char const* name, char const* str, std::vector<uint32_t>& mask)
+  {
+    std::vector<std::pair<int, int>> ranges;
+    int maxCU = 0;
+    std::string tokenStr(str); // strtok modifies the string it parses
+    char* token = strtok(&tokenStr[0], ",");
+    while (token)
+    {
+      int start, end;
+      if (sscanf(token, "%d-%d", &start, &end) == 2)
+      {
+        ranges.push_back(std::make_pair(std::min(start, end), std::max(start, end)));
+        maxCU = std::max(maxCU, std::max(start, end));
+      }
+      else if (sscanf(token, "%d", &start) == 1)
+      {
+        ranges.push_back(std::make_pair(start, start));
+        maxCU = std::max(maxCU, start);
+      }
+      else
+      {
+        InputError("Unrecognized token [%s] in %s", token, name);
+      }
+      token = strtok(NULL, ",");
+    }
+    mask.resize(maxCU / 32 + 1, 0);
+
+    for (auto range : ranges)
+    {
+      for (int i = range.first; i <= range.second; i++)
+      {
+        mask[i / 32] |= (1 << (i % 32));
+      }
+    }
+  }
+
   std::string GetCuMaskDesc() const
+  {
+    return GetCuMaskDesc(cuMask);
+  }
+
+  static std::string GetCuMaskDesc(std::vector<uint32_t> const& mask)
   {
     std::vector<std::pair<int, int>> runs;
 
     bool inRun = false;
     std::pair<int, int> curr;
     int used = 0;
-    for (int i = 0; i < cuMask.size(); i++)
+    for (int i = 0; i < mask.size(); i++)
     {
       for (int j = 0; j < 32; j++)
       {
-        if (cuMask[i] & (1 << j))
+        if (mask[i] & (1 << j))
         {
           used++;
           if (!inRun)
@@ -775,7 +1329,7 @@ public:
       }
     }
     if (inRun)
-      curr.second = cuMask.size() * 32 - 1;
+      curr.second = mask.size() * 32 - 1;
 
     std::string result = "CUs used: (" + std::to_string(used) + ") ";
     for (int i = 0; i < runs.size(); i++)
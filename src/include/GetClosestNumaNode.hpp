@@ -29,6 +29,7 @@ THE SOFTWARE.
       hsa_status_string(error, &errString);                             \
       std::cerr << "Encountered HSA error (" << errString << ") at line " \
                 << __LINE__ << " in file " << __FILE__ << "\n";         \
+      if (throwRunErrors) RunError("HSA error (%s)", errString);        \
       exit(-1);                                                         \
     }                                                                   \
   } while (0)
@@ -141,8 +142,7 @@ int GetClosestNumaNode(int gpuIdx)
   AgentData& agentData = GetAgentData();
   if (gpuIdx < 0 || gpuIdx >= agentData.closestNumaNode.size())
   {
-    printf("[ERROR] GPU index out is out of bounds\n");
-    exit(1);
+    RunError("GPU index out is out of bounds");
   }
   return agentData.closestNumaNode[gpuIdx];
 #endif
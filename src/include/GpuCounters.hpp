@@ -0,0 +1,250 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+// Optional hardware performance counter collection for GFX kernels (build with TB_ENABLE_ROCPROFILER)
+// Counters listed in GPU_COUNTERS are collected per kernel dispatch via the rocprofiler-sdk dispatch counting
+// service, and attributed to the Transfers that were executed by that dispatch.  When a single kernel executes
+// multiple Transfers (USE_SINGLE_STREAM), counter values are split between them by their share of subExecutors,
+// as hardware counters cannot be attributed to individual threadblocks
+// When built without TB_ENABLE_ROCPROFILER, these reduce to no-ops
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(TB_ENABLE_ROCPROFILER)
+#include <rocprofiler-sdk/registration.h>
+#include <rocprofiler-sdk/rocprofiler.h>
+
+#define ROCPROFILER_CALL(cmd)                                                            \
+  do {                                                                                   \
+    rocprofiler_status_t const status = (cmd);                                           \
+    if (status != ROCPROFILER_STATUS_SUCCESS)                                            \
+    {                                                                                    \
+      RunError("rocprofiler call %s failed: %s", #cmd,                                   \
+               rocprofiler_get_status_string(status));                                   \
+    }                                                                                    \
+  } while (0)
+#endif
+
+// Owners of a kernel dispatch, with the fraction of the dispatch attributed to each
+typedef std::vector<std::pair<void const*, double>> CounterOwners;
+
+struct GpuCounterState
+{
+  bool                                                      isEnabled = false;
+  std::vector<std::string>                                  counterNames;  // Requested counters, in display order
+  std::mutex                                                mutex;         // Protects members below
+  std::map<size_t, CounterOwners>                           pendingDispatches;
+  std::map<void const*, std::map<std::string, double>>      totals;        // Accumulated values per owner
+  size_t                                                    nextDispatchId = 0;
+#if defined(TB_ENABLE_ROCPROFILER)
+  rocprofiler_context_id_t                                  context = {};
+  std::map<uint64_t, rocprofiler_profile_config_id_t>       profiles;      // Counter profile per GPU agent
+  std::map<uint64_t, std::string>                           idToName;      // Counter id to name
+#endif
+};
+
+inline GpuCounterState& GetGpuCounterState()
+{
+  static GpuCounterState state;
+  return state;
+}
+
+// Owners for kernels dispatched by the current thread (kernels are dispatched from the launching thread)
+inline CounterOwners& GetCurrentCounterOwners()
+{
+  static thread_local CounterOwners owners;
+  return owners;
+}
+
+inline bool GpuCountersEnabled() { return GetGpuCounterState().isEnabled; }
+
+inline std::vector<std::string> const& GpuCounterNames() { return GetGpuCounterState().counterNames; }
+
+// Attribute kernels dispatched by this thread, until GpuCountersEndLaunch, to the given owners
+inline void GpuCountersBeginLaunch(CounterOwners const& owners) { GetCurrentCounterOwners() = owners; }
+inline void GpuCountersEndLaunch()                              { GetCurrentCounterOwners().clear(); }
+
+// Returns accumulated counter values for an owner, and resets them
+inline std::map<std::string, double> GpuCountersTake(void const* owner)
+{
+  GpuCounterState& state = GetGpuCounterState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  std::map<std::string, double> result;
+  auto it = state.totals.find(owner);
+  if (it != state.totals.end())
+  {
+    result = it->second;
+    state.totals.erase(it);
+  }
+  return result;
+}
+
+#if defined(TB_ENABLE_ROCPROFILER)
+inline void GpuCountersDispatchCallback(rocprofiler_dispatch_counting_service_data_t dispatchData,
+                                        rocprofiler_profile_config_id_t* config,
+                                        rocprofiler_user_data_t* userData,
+                                        void* /* callbackArgs */)
+{
+  GpuCounterState& state = GetGpuCounterState();
+  CounterOwners const& owners = GetCurrentCounterOwners();
+
+  // Kernels launched outside of timed Transfer iterations are not profiled
+  if (owners.empty()) return;
+  auto it = state.profiles.find(dispatchData.dispatch_info.agent_id.handle);
+  if (it == state.profiles.end()) return;
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  *config = it->second;
+  userData->value = state.nextDispatchId;
+  state.pendingDispatches[state.nextDispatchId++] = owners;
+}
+
+inline void GpuCountersRecordCallback(rocprofiler_dispatch_counting_service_data_t /* dispatchData */,
+                                      rocprofiler_record_counter_t* records,
+                                      size_t numRecords,
+                                      rocprofiler_user_data_t userData,
+                                      void* /* callbackArgs */)
+{
+  GpuCounterState& state = GetGpuCounterState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  auto it = state.pendingDispatches.find(userData.value);
+  if (it == state.pendingDispatches.end()) return;
+
+  // Counters with multiple dimensions (e.g. per XCC / shader engine) produce one record per instance
+  for (size_t i = 0; i < numRecords; i++)
+  {
+    rocprofiler_counter_id_t counterId;
+    ROCPROFILER_CALL(rocprofiler_query_record_counter_id(records[i].id, &counterId));
+    std::string const& name = state.idToName[counterId.handle];
+    for (auto const& owner : it->second)
+      state.totals[owner.first][name] += records[i].counter_value * owner.second;
+  }
+  state.pendingDispatches.erase(it);
+}
+
+inline int GpuCountersToolInit(rocprofiler_client_finalize_t /* finalizeFunc */, void* /* toolData */)
+{
+  GpuCounterState& state = GetGpuCounterState();
+
+  // Collect GPU agents
+  std::vector<rocprofiler_agent_v0_t> gpuAgents;
+  ROCPROFILER_CALL(rocprofiler_query_available_agents(
+    ROCPROFILER_AGENT_INFO_VERSION_0,
+    [](rocprofiler_agent_version_t, void const** agents, size_t numAgents, void* userData)
+    {
+      auto* result = static_cast<std::vector<rocprofiler_agent_v0_t>*>(userData);
+      for (size_t i = 0; i < numAgents; i++)
+      {
+        auto const* agent = static_cast<rocprofiler_agent_v0_t const*>(agents[i]);
+        if (agent->type == ROCPROFILER_AGENT_TYPE_GPU) result->push_back(*agent);
+      }
+      return ROCPROFILER_STATUS_SUCCESS;
+    },
+    sizeof(rocprofiler_agent_v0_t), &gpuAgents));
+
+  // Build a profile of the requested counters for each GPU agent
+  for (auto const& agent : gpuAgents)
+  {
+    std::vector<rocprofiler_counter_id_t> supported;
+    ROCPROFILER_CALL(rocprofiler_iterate_agent_supported_counters(
+      agent.id,
+      [](rocprofiler_agent_id_t, rocprofiler_counter_id_t* counters, size_t numCounters, void* userData)
+      {
+        auto* result = static_cast<std::vector<rocprofiler_counter_id_t>*>(userData);
+        result->insert(result->end(), counters, counters + numCounters);
+        return ROCPROFILER_STATUS_SUCCESS;
+      },
+      &supported));
+
+    std::vector<rocprofiler_counter_id_t> selected;
+    for (std::string const& name : state.counterNames)
+    {
+      bool isFound = false;
+      for (auto const& counterId : supported)
+      {
+        rocprofiler_counter_info_v0_t info;
+        ROCPROFILER_CALL(rocprofiler_query_counter_info(counterId, ROCPROFILER_COUNTER_INFO_VERSION_0,
+                                                        static_cast<void*>(&info)));
+        if (name == info.name)
+        {
+          selected.push_back(counterId);
+          state.idToName[counterId.handle] = name;
+          isFound = true;
+          break;
+        }
+      }
+      if (!isFound)
+      {
+        InputError("GPU counter %s is not supported by GPU agent %u", name.c_str(), agent.node_id);
+      }
+    }
+
+    rocprofiler_profile_config_id_t profile;
+    ROCPROFILER_CALL(rocprofiler_create_profile_config(agent.id, selected.data(), selected.size(), &profile));
+    state.profiles[agent.id.handle] = profile;
+  }
+
+  ROCPROFILER_CALL(rocprofiler_create_context(&state.context));
+  ROCPROFILER_CALL(rocprofiler_configure_callback_dispatch_counting_service(
+    state.context, GpuCountersDispatchCallback, nullptr, GpuCountersRecordCallback, nullptr));
+  ROCPROFILER_CALL(rocprofiler_start_context(state.context));
+  state.isEnabled = true;
+  return 0;
+}
+
+inline void GpuCountersToolFini(void* /* toolData */)
+{
+  GpuCounterState& state = GetGpuCounterState();
+  if (state.isEnabled) rocprofiler_stop_context(state.context);
+  state.isEnabled = false;
+}
+
+// Entry point called by rocprofiler-sdk when the runtime is initialized.  Counter collection is only
+// registered when GPU_COUNTERS is set, as this is called before environment variables are otherwise parsed
+extern "C" rocprofiler_tool_configure_result_t* rocprofiler_configure(uint32_t /* version */,
+                                                                      char const* /* runtimeVersion */,
+                                                                      uint32_t /* priority */,
+                                                                      rocprofiler_client_id_t* clientId)
+{
+  char const* counterList = getenv("GPU_COUNTERS");
+  if (!counterList || !*counterList) return nullptr;
+
+  GpuCounterState& state = GetGpuCounterState();
+  std::stringstream ss(counterList);
+  std::string name;
+  while (std::getline(ss, name, ','))
+    if (!name.empty()) state.counterNames.push_back(name);
+
+  clientId->name = "TransferBench";
+  static rocprofiler_tool_configure_result_t result = {sizeof(rocprofiler_tool_configure_result_t),
+                                                       &GpuCountersToolInit, &GpuCountersToolFini, nullptr};
+  return &result;
+}
+#endif
@@ -42,11 +42,17 @@ struct SubExecParam
   float*    dst[MAX_DSTS];                      // Destination array pointers
   uint32_t  preferredXccId;                     // XCC ID to execute on
 
+  // Inputs for the work-stealing kernel (every subExecutor of a Transfer covers the whole Transfer)
+  size_t              chunkSize;                // Number of floats claimed at a time
+  unsigned long long* chunkCounter;             // Shared per Transfer: [0] next chunk to claim, [1] # finished threadblocks
+  int                 numStealers;              // Number of subExecutors sharing chunkCounter
+
   // Outputs
   long long startCycle;                         // Start timestamp for in-kernel timing (GPU-GFX executor)
   long long stopCycle;                          // Stop  timestamp for in-kernel timing (GPU-GFX executor)
   uint32_t  hwId;                               // Hardware ID
   uint32_t  xccId;                              // XCC ID
+  uint32_t  numChunks;                          // Number of chunks processed (work-stealing kernel)
 };
 
 // Macro for collecting HW_REG_HW_ID
@@ -67,6 +73,203 @@ struct SubExecParam
   val = 0
 #endif
 
+// Supported element datatypes
+// NOTE: Transfer sizes and SubExecParam.N remain specified in (4-byte) float units regardless of datatype
+enum DataType
+{
+  DATA_FP32      = 0,
+  DATA_FP16      = 1,
+  DATA_BF16      = 2,
+  DATA_FP8       = 3, // OCP E4M3 (finite-only, saturating)
+  DATA_INT32     = 4,
+  NUM_DATA_TYPES = 5
+};
+char   const DataTypeNames[NUM_DATA_TYPES][6] = {"fp32", "fp16", "bf16", "fp8", "int32"};
+size_t const DataTypeSizes[NUM_DATA_TYPES]    = {4, 2, 2, 1, 4};
+
+// Raw storage types for reduced precision datatypes
+struct Fp16Raw_t { uint16_t bits; };
+struct Bf16Raw_t { uint16_t bits; };
+struct Fp8Raw_t  { uint8_t  bits; };
+
+union FloatBits_t
+{
+  float    f;
+  uint32_t u;
+};
+__host__ __device__ __forceinline__ uint32_t FloatToBits(float f)    { FloatBits_t b; b.f = f; return b.u; }
+__host__ __device__ __forceinline__ float    BitsToFloat(uint32_t u) { FloatBits_t b; b.u = u; return b.f; }
+
+// Conversions to / from float (round-to-nearest-even)
+template <typename T> __host__ __device__ __forceinline__ float ToFloat(T x);
+template <typename T> __host__ __device__ __forceinline__ T     FromFloat(float f);
+
+template <> __host__ __device__ __forceinline__ float ToFloat(float x)   { return x; }
+template <> __host__ __device__ __forceinline__ float FromFloat(float f) { return f; }
+
+template <> __host__ __device__ __forceinline__ float ToFloat(Bf16Raw_t x)
+{
+  return BitsToFloat((uint32_t)x.bits << 16);
+}
+template <> __host__ __device__ __forceinline__ Bf16Raw_t FromFloat(float f)
+{
+  uint32_t u = FloatToBits(f);
+  if ((u & 0x7fffffff) > 0x7f800000) return {(uint16_t)((u >> 16) | 0x40)}; // Quiet NaN
+  u += 0x7fff + ((u >> 16) & 1);
+  return {(uint16_t)(u >> 16)};
+}
+
+template <> __host__ __device__ __forceinline__ float ToFloat(Fp16Raw_t x)
+{
+  uint32_t const sign = (uint32_t)(x.bits & 0x8000) << 16;
+  uint32_t       exp  = (x.bits >> 10) & 0x1f;
+  uint32_t       mant = x.bits & 0x3ff;
+
+  if (exp == 0x1f) return BitsToFloat(sign | 0x7f800000 | (mant << 13)); // Inf / NaN
+  if (exp == 0)
+  {
+    if (mant == 0) return BitsToFloat(sign);
+    // Normalize subnormal value
+    exp = 113;
+    while (!(mant & 0x400)) { mant <<= 1; exp--; }
+    return BitsToFloat(sign | (exp << 23) | ((mant & 0x3ff) << 13));
+  }
+  return BitsToFloat(sign | ((exp + 112) << 23) | (mant << 13));
+}
+template <> __host__ __device__ __forceinline__ Fp16Raw_t FromFloat(float f)
+{
+  uint32_t const u    = FloatToBits(f);
+  uint32_t const sign = (u >> 16) & 0x8000;
+  uint32_t const absu = u & 0x7fffffff;
+
+  if (absu >  0x7f800000) return {(uint16_t)(sign | 0x7e00)}; // NaN
+  if (absu >= 0x477ff000) return {(uint16_t)(sign | 0x7c00)}; // Overflow to infinity
+  if (absu <  0x33000000) return {(uint16_t)sign};            // Underflow to zero
+  if (absu <  0x38800000)
+  {
+    // Subnormal result
+    int      const shift = 126 - (absu >> 23);
+    uint32_t const mant  = (absu & 0x7fffff) | 0x800000;
+    uint32_t const rem   = mant & ((1u << shift) - 1);
+    uint32_t const half  = 1u << (shift - 1);
+    uint32_t       h     = mant >> shift;
+    if (rem > half || (rem == half && (h & 1))) h++;
+    return {(uint16_t)(sign | h)};
+  }
+  uint32_t const rem = absu & 0x1fff;
+  uint32_t       h   = (absu - 0x38000000) >> 13;
+  if (rem > 0x1000 || (rem == 0x1000 && (h & 1))) h++;
+  return {(uint16_t)(sign | h)};
+}
+
+template <> __host__ __device__ __forceinline__ float ToFloat(Fp8Raw_t x)
+{
+  uint32_t const sign = (uint32_t)(x.bits & 0x80) << 24;
+  uint32_t const exp  = (x.bits >> 3) & 0xf;
+  uint32_t const mant = x.bits & 0x7;
+
+  if ((x.bits & 0x7f) == 0x7f) return BitsToFloat(sign | 0x7fc00000); // NaN
+  if (exp == 0)
+  {
+    float const val = mant / 512.0f;                                    // Subnormal
+    return sign ? -val : val;
+  }
+  return BitsToFloat(sign | ((exp + 120) << 23) | (mant << 20));
+}
+template <> __host__ __device__ __forceinline__ Fp8Raw_t FromFloat(float f)
+{
+  uint32_t const u    = FloatToBits(f);
+  uint32_t const sign = (u >> 24) & 0x80;
+  uint32_t const absu = u & 0x7fffffff;
+
+  if (absu >  0x7f800000) return {(uint8_t)(sign | 0x7f)}; // NaN
+  if (absu >= 0x43e00000) return {(uint8_t)(sign | 0x7e)}; // Saturate to +/-448
+  if (absu <  0x3a800000) return {(uint8_t)sign};          // Underflow to zero
+  if (absu <  0x3c800000)
+  {
+    // Subnormal result
+    int      const shift = 141 - (absu >> 23);
+    uint32_t const mant  = (absu & 0x7fffff) | 0x800000;
+    uint32_t const rem   = mant & ((1u << shift) - 1);
+    uint32_t const half  = 1u << (shift - 1);
+    uint32_t       h     = mant >> shift;
+    if (rem > half || (rem == half && (h & 1))) h++;
+    return {(uint8_t)(sign | h)};
+  }
+  uint32_t const rem = absu & 0xfffff;
+  uint32_t       h   = (absu - 0x3c000000) >> 20;
+  if (rem > 0x80000 || (rem == 0x80000 && (h & 1))) h++;
+  return {(uint8_t)(sign | h)};
+}
+
+// Accumulation operations, either in fp32 (AccT = float), or natively (AccT = T) rounding after every addition
+template <typename T, typename AccT> struct AccOps;
+template <typename T> struct AccOps<T, float>
+{
+  static __host__ __device__ __forceinline__ float To(T x)              { return ToFloat(x); }
+  static __host__ __device__ __forceinline__ float Add(float a, float b) { return a + b; }
+  static __host__ __device__ __forceinline__ T     From(float a)         { return FromFloat<T>(a); }
+};
+template <typename T> struct AccOps<T, T>
+{
+  static __host__ __device__ __forceinline__ T     To(T x)               { return x; }
+  static __host__ __device__ __forceinline__ T     Add(T a, T b)         { return FromFloat<T>(ToFloat(a) + ToFloat(b)); }
+  static __host__ __device__ __forceinline__ T     From(T a)             { return a; }
+};
+template <> struct AccOps<float, float>
+{
+  static __host__ __device__ __forceinline__ float To(float x)           { return x; }
+  static __host__ __device__ __forceinline__ float Add(float a, float b) { return a + b; }
+  static __host__ __device__ __forceinline__ float From(float a)         { return a; }
+};
+template <> struct AccOps<int32_t, int32_t>
+{
+  static __host__ __device__ __forceinline__ int32_t To(int32_t x)             { return x; }
+  static __host__ __device__ __forceinline__ int32_t Add(int32_t a, int32_t b) { return (int32_t)((uint32_t)a + (uint32_t)b); }
+  static __host__ __device__ __forceinline__ int32_t From(int32_t a)           { return a; }
+};
+
+// Accumulates the elements of type T packed within raw chunks of type RawT
+template <typename T, typename AccT, typename RawT>
+struct Accumulator
+{
+  static int constexpr NUM_ELEMS = sizeof(RawT) / sizeof(T);
+  AccT vals[NUM_ELEMS];
+
+  __device__ __forceinline__ void Load(RawT const& raw)
+  {
+    T const* elems = reinterpret_cast<T const*>(&raw);
+    #pragma unroll
+    for (int k = 0; k < NUM_ELEMS; k++) vals[k] = AccOps<T, AccT>::To(elems[k]);
+  }
+
+  __device__ __forceinline__ void Add(RawT const& raw)
+  {
+    T const* elems = reinterpret_cast<T const*>(&raw);
+    #pragma unroll
+    for (int k = 0; k < NUM_ELEMS; k++) vals[k] = AccOps<T, AccT>::Add(vals[k], AccOps<T, AccT>::To(elems[k]));
+  }
+
+  __device__ __forceinline__ RawT Store() const
+  {
+    RawT raw;
+    T* elems = reinterpret_cast<T*>(&raw);
+    #pragma unroll
+    for (int k = 0; k < NUM_ELEMS; k++) elems[k] = AccOps<T, AccT>::From(vals[k]);
+    return raw;
+  }
+};
+
+// fp32 operates directly on packed floats
+template <>
+struct Accumulator<float, float, float4>
+{
+  float4 val;
+  __device__ __forceinline__ void   Load(float4 const& raw) { val = raw; }
+  __device__ __forceinline__ void   Add(float4 const& raw)  { val += raw; }
+  __device__ __forceinline__ float4 Store() const           { return val; }
+};
+
 void CpuReduceKernel(SubExecParam const& p)
 {
   int const& numSrcs = p.numSrcs;
@@ -96,6 +299,200 @@ void CpuReduceKernel(SubExecParam const& p)
   }
 }
 
+// Vectorized CPU kernels are only built for the host pass of x86-64 compilation
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__) && !defined(__CUDA_ARCH__)
+#define CPU_SIMD_SUPPORTED 1
+#include <immintrin.h>
+#else
+#define CPU_SIMD_SUPPORTED 0
+#endif
+
+#define CPU_PREFETCH_BYTES 1024 // How far ahead of the current position to prefetch source data
+
+// Scalar reduction of elements [start, end), used for unaligned heads / tails of vectorized kernels
+inline void CpuReduceRange(SubExecParam const& p, size_t const start, size_t const end)
+{
+  for (size_t j = start; j < end; j++)
+  {
+    float sum = (p.numSrcs == 0 ? MEMSET_VAL : p.src[0][j]);
+    for (int i = 1; i < p.numSrcs; i++) sum += p.src[i][j];
+    for (int i = 0; i < p.numDsts; i++) p.dst[i][j] = sum;
+  }
+}
+
+#if CPU_SIMD_SUPPORTED
+// AVX2 reduce kernel, optionally using non-temporal (streaming) stores and software prefetch
+template <bool USE_NT_STORES, bool USE_PREFETCH>
+__attribute__((target("avx2")))
+void CpuReduceKernelAvx2(SubExecParam const& p)
+{
+  int    const numSrcs = p.numSrcs;
+  int    const numDsts = p.numDsts;
+  size_t const N       = p.N;
+  size_t const VEC_LEN = sizeof(__m256) / sizeof(float);
+
+  // Peel off scalar elements until the first destination is vector-aligned
+  size_t const head = (numDsts == 0) ? 0 : std::min(N, ((sizeof(__m256) - ((uintptr_t)p.dst[0] % sizeof(__m256))) % sizeof(__m256)) / sizeof(float));
+  CpuReduceRange(p, 0, head);
+
+  // Streaming stores require aligned addresses, other destinations fall back to regular stores
+  bool isAligned[MAX_DSTS];
+  for (int i = 0; i < numDsts; i++)
+    isAligned[i] = ((uintptr_t)(p.dst[i] + head) % sizeof(__m256) == 0);
+
+  size_t j = head;
+  for (; j + VEC_LEN <= N; j += VEC_LEN)
+  {
+    __m256 sum;
+    if (numSrcs == 0)
+      sum = _mm256_set1_ps(MEMSET_VAL);
+    else
+    {
+      if (USE_PREFETCH)
+        for (int i = 0; i < numSrcs; i++)
+          _mm_prefetch((char const*)(p.src[i] + j) + CPU_PREFETCH_BYTES, _MM_HINT_T0);
+
+      sum = _mm256_loadu_ps(p.src[0] + j);
+      for (int i = 1; i < numSrcs; i++)
+        sum = _mm256_add_ps(sum, _mm256_loadu_ps(p.src[i] + j));
+    }
+
+    for (int i = 0; i < numDsts; i++)
+    {
+      if (USE_NT_STORES && isAligned[i]) _mm256_stream_ps(p.dst[i] + j, sum);
+      else                               _mm256_storeu_ps(p.dst[i] + j, sum);
+    }
+  }
+  CpuReduceRange(p, j, N);
+
+  // Make streaming stores globally visible
+  if (USE_NT_STORES) _mm_sfence();
+}
+
+// AVX-512 reduce kernel, optionally using non-temporal (streaming) stores and software prefetch
+template <bool USE_NT_STORES, bool USE_PREFETCH>
+__attribute__((target("avx512f")))
+void CpuReduceKernelAvx512(SubExecParam const& p)
+{
+  int    const numSrcs = p.numSrcs;
+  int    const numDsts = p.numDsts;
+  size_t const N       = p.N;
+  size_t const VEC_LEN = sizeof(__m512) / sizeof(float);
+
+  // Peel off scalar elements until the first destination is vector-aligned
+  size_t const head = (numDsts == 0) ? 0 : std::min(N, ((sizeof(__m512) - ((uintptr_t)p.dst[0] % sizeof(__m512))) % sizeof(__m512)) / sizeof(float));
+  CpuReduceRange(p, 0, head);
+
+  // Streaming stores require aligned addresses, other destinations fall back to regular stores
+  bool isAligned[MAX_DSTS];
+  for (int i = 0; i < numDsts; i++)
+    isAligned[i] = ((uintptr_t)(p.dst[i] + head) % sizeof(__m512) == 0);
+
+  size_t j = head;
+  for (; j + VEC_LEN <= N; j += VEC_LEN)
+  {
+    __m512 sum;
+    if (numSrcs == 0)
+      sum = _mm512_set1_ps(MEMSET_VAL);
+    else
+    {
+      if (USE_PREFETCH)
+        for (int i = 0; i < numSrcs; i++)
+          _mm_prefetch((char const*)(p.src[i] + j) + CPU_PREFETCH_BYTES, _MM_HINT_T0);
+
+      sum = _mm512_loadu_ps(p.src[0] + j);
+      for (int i = 1; i < numSrcs; i++)
+        sum = _mm512_add_ps(sum, _mm512_loadu_ps(p.src[i] + j));
+    }
+
+    for (int i = 0; i < numDsts; i++)
+    {
+      if (USE_NT_STORES && isAligned[i]) _mm512_stream_ps(p.dst[i] + j, sum);
+      else                               _mm512_storeu_ps(p.dst[i] + j, sum);
+    }
+  }
+  CpuReduceRange(p, j, N);
+
+  // Make streaming stores globally visible
+  if (USE_NT_STORES) _mm_sfence();
+}
+#define CPU_KERNEL_AVX2(NT, PF)   CpuReduceKernelAvx2<NT, PF>
+#define CPU_KERNEL_AVX512(NT, PF) CpuReduceKernelAvx512<NT, PF>
+#else
+#define CPU_KERNEL_AVX2(NT, PF)   CpuReduceKernel
+#define CPU_KERNEL_AVX512(NT, PF) CpuReduceKernel
+#endif
+
+#define NUM_CPU_KERNELS 7
+typedef void (*CpuKernelFuncPtr)(SubExecParam const&);
+
+CpuKernelFuncPtr CpuKernelTable[NUM_CPU_KERNELS] =
+{
+  CpuReduceKernel,
+  CPU_KERNEL_AVX2(false, false),
+  CPU_KERNEL_AVX2(true,  false),
+  CPU_KERNEL_AVX2(true,  true),
+  CPU_KERNEL_AVX512(false, false),
+  CPU_KERNEL_AVX512(true,  false),
+  CPU_KERNEL_AVX512(true,  true)
+};
+
+std::string CpuKernelNames[NUM_CPU_KERNELS] =
+{
+  "Default - memcpy / scalar",
+  "AVX2",
+  "AVX2 + NT stores",
+  "AVX2 + NT stores + prefetch",
+  "AVX-512",
+  "AVX-512 + NT stores",
+  "AVX-512 + NT stores + prefetch",
+};
+
+// Scalar CPU reduce kernel for non-fp32 datatypes
+template <typename T, typename AccT>
+void CpuReduceKernelTyped(SubExecParam const& p)
+{
+  // Memset / copy are datatype-agnostic
+  if (p.numSrcs <= 1)
+  {
+    CpuReduceKernel(p);
+    return;
+  }
+
+  size_t const numElems = p.N * sizeof(float) / sizeof(T);
+  for (size_t j = 0; j < numElems; j++)
+  {
+    AccT acc = AccOps<T, AccT>::To(((T const*)p.src[0])[j]);
+    for (int i = 1; i < p.numSrcs; i++)
+      acc = AccOps<T, AccT>::Add(acc, AccOps<T, AccT>::To(((T const*)p.src[i])[j]));
+    T const val = AccOps<T, AccT>::From(acc);
+    for (int i = 0; i < p.numDsts; i++)
+      ((T*)p.dst[i])[j] = val;
+  }
+}
+
+// CPU kernels per [datatype][native accumulation] (used instead of CpuKernelTable for non-fp32 datatypes)
+CpuKernelFuncPtr CpuTypedKernelTable[NUM_DATA_TYPES][2] =
+{
+  {CpuReduceKernel,                           CpuReduceKernel},
+  {CpuReduceKernelTyped<Fp16Raw_t, float>,    CpuReduceKernelTyped<Fp16Raw_t, Fp16Raw_t>},
+  {CpuReduceKernelTyped<Bf16Raw_t, float>,    CpuReduceKernelTyped<Bf16Raw_t, Bf16Raw_t>},
+  {CpuReduceKernelTyped<Fp8Raw_t,  float>,    CpuReduceKernelTyped<Fp8Raw_t,  Fp8Raw_t>},
+  {CpuReduceKernelTyped<int32_t,   int32_t>,  CpuReduceKernelTyped<int32_t,   int32_t>}
+};
+
+// Checks whether the running CPU supports the instruction set required by a CPU kernel
+inline bool IsCpuKernelSupported(int const cpuKernel)
+{
+#if CPU_SIMD_SUPPORTED
+  if (1 <= cpuKernel && cpuKernel <= 3) return __builtin_cpu_supports("avx2");
+  if (4 <= cpuKernel && cpuKernel <= 6) return __builtin_cpu_supports("avx512f");
+  return true;
+#else
+  return cpuKernel == 0;
+#endif
+}
+
 std::string PrepSrcValueString()
 {
   return "Element i = ((i * 517) modulo 383 + 31) * (srcBufferIdx + 1)";
@@ -106,6 +503,18 @@ __host__ __device__ float PrepSrcValue(int srcBufferIdx, size_t idx)
   return (((idx % 383) * 517) % 383 + 31) * (srcBufferIdx + 1);
 }
 
+// Source values for other datatypes (fp8 values are scaled down to stay within range)
+template <typename T>
+__host__ __device__ T PrepSrcTypedValue(int srcBufferIdx, size_t idx)
+{
+  return FromFloat<T>(PrepSrcValue(srcBufferIdx, idx) * (sizeof(T) == 1 ? 0.015625f : 1.0f));
+}
+template <>
+__host__ __device__ int32_t PrepSrcTypedValue(int srcBufferIdx, size_t idx)
+{
+  return (int32_t)PrepSrcValue(srcBufferIdx, idx);
+}
+
 __global__ void CollectXccIdsKernel(int* xccIds)
 {
   int xccId;
@@ -113,15 +522,227 @@ __global__ void CollectXccIdsKernel(int* xccIds)
   xccIds[blockIdx.x] = xccId;
 }
 
-// GPU kernel to prepare src buffer data
+// GPU kernel to prepare src buffer data (N is the number of elements of type T)
+template <typename T>
+__global__ void
+PrepSrcDataKernel(T* ptr, size_t N, int srcBufferIdx)
+{
+  for (size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+       idx < N;
+       idx += blockDim.x * gridDim.x)
+  {
+    ptr[idx] = PrepSrcTypedValue<T>(srcBufferIdx, idx);
+  }
+}
+
+// Source value of element idx of type T when using a fill pattern (pattern is applied to raw bytes)
+template <typename T>
+__host__ __device__ T PatternTypedValue(float const* pattern, size_t patternLen, size_t idx)
+{
+  size_t const byteIdx = idx * sizeof(T);
+  float  const val     = pattern[(byteIdx / sizeof(float)) % patternLen];
+  T result;
+  unsigned char const* srcBytes = (unsigned char const*)&val + (byteIdx % sizeof(float));
+  unsigned char*       dstBytes = (unsigned char*)&result;
+  for (size_t i = 0; i < sizeof(T); i++) dstBytes[i] = srcBytes[i];
+  return result;
+}
+
+// Expected value of element idx of type T for source buffer srcBufferIdx, or for a destination
+// buffer (srcBufferIdx < 0) produced by reducing numSrcs sources the same way as the reduction kernels
+template <typename T, typename AccT>
+__host__ __device__ T ExpectedTypedValue(int numSrcs, int srcBufferIdx, size_t idx,
+                                         float const* pattern, size_t patternLen)
+{
+  if (srcBufferIdx >= 0)
+    return patternLen ? PatternTypedValue<T>(pattern, patternLen, idx) : PrepSrcTypedValue<T>(srcBufferIdx, idx);
+
+  if (numSrcs == 0)
+  {
+    T result;
+    unsigned char* bytes = (unsigned char*)&result;
+    for (size_t i = 0; i < sizeof(T); i++) bytes[i] = MEMSET_CHAR;
+    return result;
+  }
+
+  T const first = ExpectedTypedValue<T, AccT>(numSrcs, 0, idx, pattern, patternLen);
+  if (numSrcs == 1) return first;
+
+  AccT acc = AccOps<T, AccT>::To(first);
+  for (int i = 1; i < numSrcs; i++)
+    acc = AccOps<T, AccT>::Add(acc, AccOps<T, AccT>::To(ExpectedTypedValue<T, AccT>(numSrcs, i, idx, pattern, patternLen)));
+  return AccOps<T, AccT>::From(acc);
+}
+
+// fp32 values are compared by value, all other datatypes are compared bitwise
+template <typename T>
+__host__ __device__ __forceinline__ bool TypedValuesMatch(T const& a, T const& b)
+{
+  unsigned char const* aBytes = (unsigned char const*)&a;
+  unsigned char const* bBytes = (unsigned char const*)&b;
+  for (size_t i = 0; i < sizeof(T); i++)
+    if (aBytes[i] != bBytes[i]) return false;
+  return true;
+}
+template <>
+__host__ __device__ __forceinline__ bool TypedValuesMatch(float const& a, float const& b)
+{
+  return a == b;
+}
+
+// GPU kernel to validate a buffer of N elements of type T in place against ExpectedTypedValue
+// results[0] accumulates the number of mismatching elements, results[1] the index of the first mismatch
+template <typename T, typename AccT>
 __global__ void
-PrepSrcDataKernel(float* ptr, size_t N, int srcBufferIdx)
+ValidateBufferKernel(T const* ptr, size_t N, int numSrcs, int srcBufferIdx,
+                     float const* pattern, size_t patternLen, unsigned long long* results)
 {
+  unsigned long long numMismatches = 0;
+  unsigned long long firstMismatch = ~0ULL;
   for (size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
        idx < N;
        idx += blockDim.x * gridDim.x)
   {
-    ptr[idx] = PrepSrcValue(srcBufferIdx, idx);
+    if (!TypedValuesMatch(ptr[idx], ExpectedTypedValue<T, AccT>(numSrcs, srcBufferIdx, idx, pattern, patternLen)))
+    {
+      if (numMismatches == 0) firstMismatch = idx;
+      numMismatches++;
+    }
+  }
+  if (numMismatches)
+  {
+    atomicAdd(&results[0], numMismatches);
+    atomicMin(&results[1], firstMismatch);
+  }
+}
+
+// Latency kernels (launched with a single thread, timed with wall_clock64)
+// Pointer-chase: each element of chain holds the index of the next element to load, so every load depends on the
+// previous one.  Loads are volatile so that they are not hoisted / cached in registers.
+// result[0] receives the elapsed cycles, result[1] the final index (so the chain can not be optimized away)
+__global__ void PointerChaseKernel(uint32_t const* chain, int numSteps, int64_t* result)
+{
+  volatile uint32_t const* ptr = chain;
+  uint32_t idx = 0;
+  int64_t const startCycle = wall_clock64();
+  for (int i = 0; i < numSteps; i++)
+    idx = ptr[idx];
+  int64_t const stopCycle = wall_clock64();
+  result[0] = stopCycle - startCycle;
+  result[1] = idx;
+}
+
+// Flag ping-pong: the initiator writes round trip number (base + i) to the remote flag and waits for it to be written
+// back to its local flag, while the responder waits on its local flag before writing back to the remote flag.
+// Counting up from base avoids having to reset flags between iterations.  result[0] receives the initiator's cycles
+__global__ void PingPongKernel(uint32_t* localFlag, uint32_t* remoteFlag, uint32_t base, int numRoundTrips,
+                               int isInitiator, int64_t* result)
+{
+  volatile uint32_t* local  = localFlag;
+  volatile uint32_t* remote = remoteFlag;
+  int64_t const startCycle = wall_clock64();
+  for (uint32_t i = base + 1; i <= base + numRoundTrips; i++)
+  {
+    if (isInitiator)
+    {
+      *remote = i;
+      __threadfence_system();
+      while (*local != i);
+    }
+    else
+    {
+      while (*local != i);
+      *remote = i;
+      __threadfence_system();
+    }
+  }
+  if (isInitiator) result[0] = wall_clock64() - startCycle;
+}
+
+// Background load kernels (BG_LOAD), run on their own stream alongside a Test until the host sets *stopFlag
+// Each threadblock only polls the flag once per pass, and records its own timing and the number of passes completed
+#define BG_FMA_PER_PASS 2048 // FMAs per thread per pass of BackgroundComputeKernel (spread over 8 independent chains)
+
+struct BackgroundResult
+{
+  int64_t            startCycle;
+  int64_t            stopCycle;
+  unsigned long long numPasses;
+  float              sink;       // Only written to keep the FMA chains from being optimized away
+};
+
+// Threadblocks agree on when to stop via LDS so that all threads of a block leave the loop on the same pass
+__device__ __forceinline__ bool BackgroundShouldStop(volatile int const* stopFlag, int& stop)
+{
+  __syncthreads();
+  if (threadIdx.x == 0) stop = *stopFlag;
+  __syncthreads();
+  return stop != 0;
+}
+
+// Compute-bound load: FP32 FMAs with no memory traffic
+__global__ void __launch_bounds__(MAX_BLOCKSIZE)
+BackgroundComputeKernel(volatile int const* stopFlag, BackgroundResult* results)
+{
+  __shared__ int stop;
+
+  float acc[8];
+  #pragma unroll
+  for (int j = 0; j < 8; j++) acc[j] = threadIdx.x * 1.0e-3f + j;
+
+  // x = x * 0.999 + 0.001 converges towards 1, so values stay finite however long the load runs
+  float const scale = 0.999f;
+  float const bias  = 0.001f;
+
+  int64_t const startCycle = wall_clock64();
+  unsigned long long numPasses = 0;
+  do
+  {
+    for (int i = 0; i < BG_FMA_PER_PASS / 8; i++)
+    {
+      #pragma unroll
+      for (int j = 0; j < 8; j++) acc[j] = fmaf(acc[j], scale, bias);
+    }
+    numPasses++;
+  } while (!BackgroundShouldStop(stopFlag, stop));
+
+  float sum = 0.0f;
+  #pragma unroll
+  for (int j = 0; j < 8; j++) sum += acc[j];
+  if (sum < 0.0f) results[blockIdx.x].sink = sum;
+
+  if (threadIdx.x == 0)
+  {
+    results[blockIdx.x].startCycle = startCycle;
+    results[blockIdx.x].stopCycle  = wall_clock64();
+    results[blockIdx.x].numPasses  = numPasses;
+  }
+}
+
+// Memory-bound load: each threadblock repeatedly copies its own contiguous slice of src to dst
+__global__ void __launch_bounds__(MAX_BLOCKSIZE)
+BackgroundStreamKernel(float4 const* src, float4* dst, size_t numPacksPerBlock,
+                       volatile int const* stopFlag, BackgroundResult* results)
+{
+  __shared__ int stop;
+
+  float4 const* blockSrc = src + blockIdx.x * numPacksPerBlock;
+  float4*       blockDst = dst + blockIdx.x * numPacksPerBlock;
+
+  int64_t const startCycle = wall_clock64();
+  unsigned long long numPasses = 0;
+  do
+  {
+    for (size_t i = threadIdx.x; i < numPacksPerBlock; i += blockDim.x)
+      blockDst[i] = blockSrc[i];
+    numPasses++;
+  } while (!BackgroundShouldStop(stopFlag, stop));
+
+  if (threadIdx.x == 0)
+  {
+    results[blockIdx.x].startCycle = startCycle;
+    results[blockIdx.x].stopCycle  = wall_clock64();
+    results[blockIdx.x].numPasses  = numPasses;
   }
 }
 
@@ -131,37 +752,31 @@ template <>           __device__ __forceinline__ float  MemsetVal(){ return MEMS
 template <>           __device__ __forceinline__ float4 MemsetVal(){ return make_float4(MEMSET_VAL, MEMSET_VAL, MEMSET_VAL, MEMSET_VAL); }
 
 // GPU copy kernel 0: 3 loops: unroll float 4, float4s, floats
-template <int LOOP1_UNROLL>
-__global__ void __launch_bounds__(MAX_BLOCKSIZE)
-GpuReduceKernel(SubExecParam* params)
+// Elements of type T are reduced using accumulation type AccT, operating on the raw packed floats
+// Work is split across numThreads threads (a whole threadblock, or a single wavefront), with tid in [0, numThreads)
+// Operates on the N floats starting offset floats into the subExecutor's arrays
+// ParamT is either SubExecParam, or a ShapeParam with #srcs / #dsts fixed at compile time
+template <int LOOP1_UNROLL, typename T, typename AccT, typename ParamT>
+__device__ __forceinline__ void GpuReduceBody(ParamT const& p, int const tid, int const numThreads,
+                                              size_t const offset, size_t const N)
 {
-  int64_t startCycle;
-  if (threadIdx.x == 0) startCycle = wall_clock64();
-
-  SubExecParam& p = params[blockIdx.y];
-
-  // Filter by XCC if desired
-  int xccId;
-  GetXccId(xccId);
-  if (p.preferredXccId != -1 && xccId != p.preferredXccId) return;
-
   // Operate on wavefront granularity
   int const numSrcs  = p.numSrcs;
   int const numDsts  = p.numDsts;
-  int const waveId   = threadIdx.x / WARP_SIZE; // Wavefront number
-  int const threadId = threadIdx.x % WARP_SIZE; // Thread index within wavefront
+  int const waveId   = tid / WARP_SIZE; // Wavefront number
+  int const threadId = tid % WARP_SIZE; // Thread index within wavefront
 
   // 1st loop - each wavefront operates on LOOP1_UNROLL x FLOATS_PER_PACK per thread per iteration
   // Determine the number of packed floats processed by the first loop
-  size_t       Nrem        = p.N;
+  size_t       Nrem        = N;
   size_t const loop1Npack  = (Nrem / (FLOATS_PER_PACK * LOOP1_UNROLL * WARP_SIZE)) * (LOOP1_UNROLL * WARP_SIZE);
   size_t const loop1Nelem  = loop1Npack * FLOATS_PER_PACK;
-  size_t const loop1Inc    = blockDim.x * LOOP1_UNROLL;
+  size_t const loop1Inc    = numThreads * LOOP1_UNROLL;
   size_t       loop1Offset = waveId * LOOP1_UNROLL * WARP_SIZE + threadId;
 
   while (loop1Offset < loop1Npack)
   {
-    PackedFloat_t vals[LOOP1_UNROLL] = {};
+    PackedFloat_t vals[LOOP1_UNROLL];
 
     if (numSrcs == 0)
     {
@@ -170,18 +785,27 @@ GpuReduceKernel(SubExecParam* params)
     }
     else
     {
-      for (int i = 0; i < numSrcs; ++i)
+      Accumulator<T, AccT, PackedFloat_t> accs[LOOP1_UNROLL];
+      PackedFloat_t const* __restrict__ packedSrc0 = (PackedFloat_t const*)(p.src[0] + offset) + loop1Offset;
+      #pragma unroll
+      for (int u = 0; u < LOOP1_UNROLL; ++u)
+        accs[u].Load(*(packedSrc0 + u * WARP_SIZE));
+
+      for (int i = 1; i < numSrcs; ++i)
       {
-        PackedFloat_t const* __restrict__ packedSrc = (PackedFloat_t const*)(p.src[i]) + loop1Offset;
+        PackedFloat_t const* __restrict__ packedSrc = (PackedFloat_t const*)(p.src[i] + offset) + loop1Offset;
         #pragma unroll
         for (int u = 0; u < LOOP1_UNROLL; ++u)
-          vals[u] += *(packedSrc + u * WARP_SIZE);
+          accs[u].Add(*(packedSrc + u * WARP_SIZE));
       }
+
+      #pragma unroll
+      for (int u = 0; u < LOOP1_UNROLL; ++u) vals[u] = accs[u].Store();
     }
 
     for (int i = 0; i < numDsts; ++i)
     {
-      PackedFloat_t* __restrict__ packedDst = (PackedFloat_t*)(p.dst[i]) + loop1Offset;
+      PackedFloat_t* __restrict__ packedDst = (PackedFloat_t*)(p.dst[i] + offset) + loop1Offset;
       #pragma unroll
       for (int u = 0; u < LOOP1_UNROLL; ++u) *(packedDst + u * WARP_SIZE) = vals[u];
     }
@@ -195,8 +819,8 @@ GpuReduceKernel(SubExecParam* params)
     // NOTE: Using int32_t due to smaller size requirements
     int32_t const loop2Npack  = Nrem / FLOATS_PER_PACK;
     int32_t const loop2Nelem  = loop2Npack * FLOATS_PER_PACK;
-    int32_t const loop2Inc    = blockDim.x;
-    int32_t       loop2Offset = threadIdx.x;
+    int32_t const loop2Inc    = numThreads;
+    int32_t       loop2Offset = tid;
 
     while (loop2Offset < loop2Npack)
     {
@@ -207,17 +831,19 @@ GpuReduceKernel(SubExecParam* params)
       }
       else
       {
-        val = {};
-        for (int i = 0; i < numSrcs; ++i)
+        Accumulator<T, AccT, PackedFloat_t> acc;
+        acc.Load(*((PackedFloat_t const*)(p.src[0] + offset + loop1Nelem) + loop2Offset));
+        for (int i = 1; i < numSrcs; ++i)
         {
-          PackedFloat_t const* __restrict__ packedSrc = (PackedFloat_t const*)(p.src[i] + loop1Nelem) + loop2Offset;
-          val += *packedSrc;
+          PackedFloat_t const* __restrict__ packedSrc = (PackedFloat_t const*)(p.src[i] + offset + loop1Nelem) + loop2Offset;
+          acc.Add(*packedSrc);
         }
+        val = acc.Store();
       }
 
       for (int i = 0; i < numDsts; ++i)
       {
-        PackedFloat_t* __restrict__ packedDst = (PackedFloat_t*)(p.dst[i] + loop1Nelem) + loop2Offset;
+        PackedFloat_t* __restrict__ packedDst = (PackedFloat_t*)(p.dst[i] + offset + loop1Nelem) + loop2Offset;
         *packedDst = val;
       }
       loop2Offset += loop2Inc;
@@ -225,24 +851,81 @@ GpuReduceKernel(SubExecParam* params)
     Nrem -= loop2Nelem;
 
     // Deal with leftovers less than FLOATS_PER_PACK)
-    if (threadIdx.x < Nrem)
+    if (tid < Nrem)
     {
-      int offset = loop1Nelem + loop2Nelem + threadIdx.x;
-      float val = 0;
+      size_t const leftoverOffset = offset + loop1Nelem + loop2Nelem + tid;
+      float val;
       if (numSrcs == 0)
       {
         val = MEMSET_VAL;
       }
       else
       {
-        for (int i = 0; i < numSrcs; ++i)
-          val += p.src[i][offset];
+        Accumulator<T, AccT, float> acc;
+        acc.Load(p.src[0][leftoverOffset]);
+        for (int i = 1; i < numSrcs; ++i)
+          acc.Add(p.src[i][leftoverOffset]);
+        val = acc.Store();
       }
 
       for (int i = 0; i < numDsts; ++i)
-        p.dst[i][offset] = val;
+        p.dst[i][leftoverOffset] = val;
     }
   }
+}
+
+// Compact copy of only the src / dst pointers a subExecutor uses, for Transfers with a common shape (#srcs -> #dsts)
+// With the counts known at compile time, the src / dst loops are fully unrolled and the pointers stay in registers
+// instead of being re-read from the (up to MAX_SRCS + MAX_DSTS pointer) SubExecParam on every pass
+template <int NUM_SRCS, int NUM_DSTS>
+struct ShapeParam
+{
+  static constexpr int numSrcs = NUM_SRCS;
+  static constexpr int numDsts = NUM_DSTS;
+  float* src[NUM_SRCS];
+  float* dst[NUM_DSTS];
+};
+
+// Runs GpuReduceBody over a whole subExecutor, specialized by shape (NUM_SRCS / NUM_DSTS of -1 read them at runtime)
+template <int LOOP1_UNROLL, typename T, typename AccT, int NUM_SRCS, int NUM_DSTS>
+struct GpuReduceShape
+{
+  __device__ __forceinline__ static void Run(SubExecParam const& p, int const tid, int const numThreads)
+  {
+    ShapeParam<NUM_SRCS, NUM_DSTS> s;
+    #pragma unroll
+    for (int i = 0; i < NUM_SRCS; ++i) s.src[i] = p.src[i];
+    #pragma unroll
+    for (int i = 0; i < NUM_DSTS; ++i) s.dst[i] = p.dst[i];
+    GpuReduceBody<LOOP1_UNROLL, T, AccT>(s, tid, numThreads, 0, p.N);
+  }
+};
+
+template <int LOOP1_UNROLL, typename T, typename AccT>
+struct GpuReduceShape<LOOP1_UNROLL, T, AccT, -1, -1>
+{
+  __device__ __forceinline__ static void Run(SubExecParam const& p, int const tid, int const numThreads)
+  {
+    GpuReduceBody<LOOP1_UNROLL, T, AccT>(p, tid, numThreads, 0, p.N);
+  }
+};
+
+// Each threadblock executes one subExecutor
+template <int LOOP1_UNROLL, typename T, typename AccT, int NUM_SRCS = -1, int NUM_DSTS = -1>
+__global__ void __launch_bounds__(MAX_BLOCKSIZE)
+GpuReduceKernel(SubExecParam* params)
+{
+  int64_t startCycle;
+  if (threadIdx.x == 0) startCycle = wall_clock64();
+
+  SubExecParam& p = params[blockIdx.y];
+
+  // Filter by XCC if desired
+  int xccId;
+  GetXccId(xccId);
+  if (p.preferredXccId != -1 && xccId != p.preferredXccId) return;
+
+  GpuReduceShape<LOOP1_UNROLL, T, AccT, NUM_SRCS, NUM_DSTS>::Run(p, threadIdx.x, blockDim.x);
 
   __syncthreads();
   if (threadIdx.x == 0)
@@ -255,6 +938,104 @@ GpuReduceKernel(SubExecParam* params)
   }
 }
 
+// Each wavefront executes one subExecutor (subExecutors are packed blockDim.x / WARP_SIZE per threadblock)
+template <int LOOP1_UNROLL, typename T, typename AccT, int NUM_SRCS = -1, int NUM_DSTS = -1>
+__global__ void __launch_bounds__(MAX_BLOCKSIZE)
+GpuReduceWaveKernel(SubExecParam* params)
+{
+  int const waveId = threadIdx.x / WARP_SIZE;
+  int const laneId = threadIdx.x % WARP_SIZE;
+
+  int64_t startCycle;
+  if (laneId == 0) startCycle = wall_clock64();
+
+  SubExecParam& p = params[blockIdx.y * (blockDim.x / WARP_SIZE) + waveId];
+
+  // Filter by XCC if desired
+  int xccId;
+  GetXccId(xccId);
+  bool const isActive = (p.preferredXccId == -1 || xccId == p.preferredXccId);
+
+  if (isActive)
+    GpuReduceShape<LOOP1_UNROLL, T, AccT, NUM_SRCS, NUM_DSTS>::Run(p, laneId, WARP_SIZE);
+
+  // Wavefronts finish independently of each other within the threadblock
+  __threadfence_system();
+#if defined(__NVCC__)
+  // NVIDIA warps are narrower than WARP_SIZE, so synchronize the threadblock instead
+  __syncthreads();
+#endif
+  if (isActive && laneId == 0)
+  {
+    p.stopCycle  = wall_clock64();
+    p.startCycle = startCycle;
+    p.xccId      = xccId;
+    __trace_hwreg();
+  }
+}
+
+// Each threadblock repeatedly claims the next chunk of its Transfer from a counter shared by all threadblocks of
+// the Transfer until none are left, so faster CUs take on more of the work instead of waiting on the slowest one
+// Only the claimed chunk index is shared (via LDS), keeping per-thread state the same as the static kernel
+// The last threadblock to finish resets the counter, so no reset is needed between launches
+template <int LOOP1_UNROLL, typename T, typename AccT>
+__global__ void __launch_bounds__(MAX_BLOCKSIZE)
+GpuStealKernel(SubExecParam* params)
+{
+  int64_t startCycle;
+  if (threadIdx.x == 0) startCycle = wall_clock64();
+
+  SubExecParam& p = params[blockIdx.y];
+
+  // Filter by XCC if desired (filtered threadblocks do not claim any chunks)
+  int xccId;
+  GetXccId(xccId);
+  bool const isActive = (p.chunkCounter != nullptr) && (p.preferredXccId == -1 || xccId == p.preferredXccId);
+
+  __shared__ unsigned long long sharedChunkIdx;
+  uint32_t numChunksDone = 0;
+  if (isActive)
+  {
+    size_t const numChunks = (p.N + p.chunkSize - 1) / p.chunkSize;
+    while (true)
+    {
+      if (threadIdx.x == 0) sharedChunkIdx = atomicAdd(&p.chunkCounter[0], 1ULL);
+      __syncthreads();
+      size_t const chunkIdx = sharedChunkIdx;
+      __syncthreads();
+      if (chunkIdx >= numChunks) break;
+
+      size_t const offset = chunkIdx * p.chunkSize;
+      size_t const N      = (p.N - offset < p.chunkSize) ? p.N - offset : p.chunkSize;
+      GpuReduceBody<LOOP1_UNROLL, T, AccT>(p, threadIdx.x, blockDim.x, offset, N);
+      numChunksDone++;
+    }
+  }
+
+  __syncthreads();
+  if (threadIdx.x == 0)
+  {
+    __threadfence_system();
+    if (isActive)
+    {
+      p.stopCycle  = wall_clock64();
+      p.startCycle = startCycle;
+      p.xccId      = xccId;
+      p.numChunks  = numChunksDone;
+      __trace_hwreg();
+    }
+
+    // Every launched threadblock (one per XCC per subExecutor) checks in once it is done claiming
+    if (p.chunkCounter != nullptr &&
+        atomicAdd(&p.chunkCounter[1], 1ULL) == (unsigned long long)p.numStealers * gridDim.x - 1)
+    {
+      p.chunkCounter[0] = 0;
+      p.chunkCounter[1] = 0;
+      __threadfence();
+    }
+  }
+}
+
 template <typename FLOAT_TYPE, int UNROLL_FACTOR>
 __device__ size_t GpuReduceFuncImpl2(SubExecParam const &p, size_t const offset, size_t const N)
 {
@@ -402,30 +1183,70 @@ GpuReduceKernel2(SubExecParam* params)
   }
 }
 
-#define NUM_GPU_KERNELS 18
+#define NUM_GPU_KERNELS     19
+#define GPU_KERNEL_UNROLL_B 17 // GpuReduceKernel2
+#define GPU_KERNEL_STEAL    18 // GpuStealKernel
 typedef void (*GpuKernelFuncPtr)(SubExecParam*);
 
-GpuKernelFuncPtr GpuKernelTable[NUM_GPU_KERNELS] =
-{
-  GpuReduceKernel<8>,
-  GpuReduceKernel<1>,
-  GpuReduceKernel<2>,
-  GpuReduceKernel<3>,
-  GpuReduceKernel<4>,
-  GpuReduceKernel<5>,
-  GpuReduceKernel<6>,
-  GpuReduceKernel<7>,
-  GpuReduceKernel<8>,
-  GpuReduceKernel<9>,
-  GpuReduceKernel<10>,
-  GpuReduceKernel<11>,
-  GpuReduceKernel<12>,
-  GpuReduceKernel<13>,
-  GpuReduceKernel<14>,
-  GpuReduceKernel<15>,
-  GpuReduceKernel<16>,
-  GpuReduceKernel2
-};
+// NOTE: GpuReduceKernel2 only supports fp32 / threadblock granularity
+//       GpuStealKernel only supports threadblock granularity
+#define GPU_KERNEL_LIST(KERNEL, T, ACC)                                \
+  {                                                                    \
+    KERNEL<8, T, ACC>,                                                 \
+    KERNEL<1, T, ACC>,  KERNEL<2, T, ACC>,  KERNEL<3, T, ACC>,         \
+    KERNEL<4, T, ACC>,  KERNEL<5, T, ACC>,  KERNEL<6, T, ACC>,         \
+    KERNEL<7, T, ACC>,  KERNEL<8, T, ACC>,  KERNEL<9, T, ACC>,         \
+    KERNEL<10, T, ACC>, KERNEL<11, T, ACC>, KERNEL<12, T, ACC>,        \
+    KERNEL<13, T, ACC>, KERNEL<14, T, ACC>, KERNEL<15, T, ACC>,        \
+    KERNEL<16, T, ACC>,                                                \
+    GpuReduceKernel2,                                                  \
+    GpuStealKernel<8, T, ACC>                                          \
+  }
+
+#define GPU_KERNEL_TABLE(KERNEL)                                                                   \
+  {                                                                                                \
+    {GPU_KERNEL_LIST(KERNEL, float,     float), GPU_KERNEL_LIST(KERNEL, float,     float)},        \
+    {GPU_KERNEL_LIST(KERNEL, Fp16Raw_t, float), GPU_KERNEL_LIST(KERNEL, Fp16Raw_t, Fp16Raw_t)},    \
+    {GPU_KERNEL_LIST(KERNEL, Bf16Raw_t, float), GPU_KERNEL_LIST(KERNEL, Bf16Raw_t, Bf16Raw_t)},    \
+    {GPU_KERNEL_LIST(KERNEL, Fp8Raw_t,  float), GPU_KERNEL_LIST(KERNEL, Fp8Raw_t,  Fp8Raw_t)},     \
+    {GPU_KERNEL_LIST(KERNEL, int32_t, int32_t), GPU_KERNEL_LIST(KERNEL, int32_t, int32_t)}         \
+  }
+
+// GPU kernels per [datatype][native accumulation][kernel], for threadblock / wavefront subExecutors
+GpuKernelFuncPtr GpuKernelTable[NUM_DATA_TYPES][2][NUM_GPU_KERNELS]     = GPU_KERNEL_TABLE(GpuReduceKernel);
+GpuKernelFuncPtr GpuWaveKernelTable[NUM_DATA_TYPES][2][NUM_GPU_KERNELS] = GPU_KERNEL_TABLE(GpuReduceWaveKernel);
+
+// Transfer shapes (#srcs -> #dsts) with kernels specialized for them (default 8x unroll only)
+#define NUM_GPU_SHAPES 5
+int const GpuShapeNumSrcs[NUM_GPU_SHAPES] = {1, 2, 1, 4, 8};
+int const GpuShapeNumDsts[NUM_GPU_SHAPES] = {1, 1, 2, 1, 1};
+
+// Returns the index of the specialized shape for numSrcs -> numDsts, or -1 if the generic kernel has to be used
+inline int GetGpuShape(int const numSrcs, int const numDsts)
+{
+  for (int i = 0; i < NUM_GPU_SHAPES; i++)
+    if (GpuShapeNumSrcs[i] == numSrcs && GpuShapeNumDsts[i] == numDsts) return i;
+  return -1;
+}
+
+#define GPU_SHAPE_KERNEL_LIST(KERNEL, T, ACC)                                                      \
+  {                                                                                                \
+    KERNEL<8, T, ACC, 1, 1>, KERNEL<8, T, ACC, 2, 1>, KERNEL<8, T, ACC, 1, 2>,                     \
+    KERNEL<8, T, ACC, 4, 1>, KERNEL<8, T, ACC, 8, 1>                                               \
+  }
+
+#define GPU_SHAPE_KERNEL_TABLE(KERNEL)                                                             \
+  {                                                                                                \
+    {GPU_SHAPE_KERNEL_LIST(KERNEL, float,     float), GPU_SHAPE_KERNEL_LIST(KERNEL, float,     float)},     \
+    {GPU_SHAPE_KERNEL_LIST(KERNEL, Fp16Raw_t, float), GPU_SHAPE_KERNEL_LIST(KERNEL, Fp16Raw_t, Fp16Raw_t)}, \
+    {GPU_SHAPE_KERNEL_LIST(KERNEL, Bf16Raw_t, float), GPU_SHAPE_KERNEL_LIST(KERNEL, Bf16Raw_t, Bf16Raw_t)}, \
+    {GPU_SHAPE_KERNEL_LIST(KERNEL, Fp8Raw_t,  float), GPU_SHAPE_KERNEL_LIST(KERNEL, Fp8Raw_t,  Fp8Raw_t)},  \
+    {GPU_SHAPE_KERNEL_LIST(KERNEL, int32_t, int32_t), GPU_SHAPE_KERNEL_LIST(KERNEL, int32_t, int32_t)}      \
+  }
+
+// Shape-specialized GPU kernels per [datatype][native accumulation][shape], for threadblock / wavefront subExecutors
+GpuKernelFuncPtr GpuShapeKernelTable[NUM_DATA_TYPES][2][NUM_GPU_SHAPES]     = GPU_SHAPE_KERNEL_TABLE(GpuReduceKernel);
+GpuKernelFuncPtr GpuWaveShapeKernelTable[NUM_DATA_TYPES][2][NUM_GPU_SHAPES] = GPU_SHAPE_KERNEL_TABLE(GpuReduceWaveKernel);
 
 std::string GpuKernelNames[NUM_GPU_KERNELS] =
 {
@@ -447,4 +1268,5 @@ std::string GpuKernelNames[NUM_GPU_KERNELS] =
   "Unroll x15",
   "Unroll x16",
   "8xUnrollB",
+  "Work-stealing 8xUnroll",
 };
@@ -0,0 +1,140 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// HDR-style log-linear histogram of durations (in milliseconds)
+// Values are recorded with nanosecond resolution into buckets whose width grows with their magnitude,
+// bounding the relative error of reported percentiles to 1 / HALF_SUB_BUCKETS, while using memory that
+// only grows with the logarithm of the largest recorded value, independent of the number of samples
+class LatencyHistogram
+{
+public:
+  LatencyHistogram() { Clear(); }
+
+  void Clear()
+  {
+    counts.clear();
+    numSamples = 0;
+    mean       = 0.0;
+    m2         = 0.0;
+    minValue   = std::numeric_limits<double>::max();
+    maxValue   = 0.0;
+  }
+
+  void Add(double const msec)
+  {
+    size_t const bucket = BucketIndex(ToNsec(msec));
+    if (bucket >= counts.size()) counts.resize(bucket + 1, 0);
+    counts[bucket]++;
+
+    // Running mean / variance (Welford)
+    numSamples++;
+    double const delta = msec - mean;
+    mean += delta / numSamples;
+    m2   += delta * (msec - mean);
+    minValue = std::min(minValue, msec);
+    maxValue = std::max(maxValue, msec);
+  }
+
+  // Combine samples from another histogram into this one
+  void Merge(LatencyHistogram const& other)
+  {
+    if (other.numSamples == 0) return;
+    if (other.counts.size() > counts.size()) counts.resize(other.counts.size(), 0);
+    for (size_t i = 0; i < other.counts.size(); i++)
+      counts[i] += other.counts[i];
+
+    size_t const total = numSamples + other.numSamples;
+    double const delta = other.mean - mean;
+    mean += delta * other.numSamples / total;
+    m2   += other.m2 + delta * delta * ((double)numSamples * other.numSamples / total);
+    numSamples = total;
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+  }
+
+  size_t Count()  const { return numSamples; }
+  double Mean()   const { return mean; }
+  double Min()    const { return numSamples ? minValue : 0.0; }
+  double Max()    const { return maxValue; }
+  double StdDev() const { return numSamples ? sqrt(m2 / numSamples) : 0.0; }
+
+  // Returns the value below which pct percent of samples fall
+  double Percentile(double const pct) const
+  {
+    if (numSamples == 0) return 0.0;
+    if (pct >= 100.0)    return maxValue;
+    size_t const target = std::max((size_t)1, (size_t)ceil(pct / 100.0 * numSamples));
+    size_t cumulative = 0;
+    for (size_t i = 0; i < counts.size(); i++)
+    {
+      cumulative += counts[i];
+      if (cumulative >= target)
+        return std::min(maxValue, std::max(minValue, BucketValue(i) / 1.0E6));
+    }
+    return maxValue;
+  }
+
+private:
+  static int const    SUB_BUCKET_BITS  = 8;
+  static size_t const SUB_BUCKETS      = 1 << SUB_BUCKET_BITS;
+  static size_t const HALF_SUB_BUCKETS = SUB_BUCKETS / 2;
+
+  static uint64_t ToNsec(double const msec)
+  {
+    return msec <= 0 ? 0 : (uint64_t)(msec * 1.0E6 + 0.5);
+  }
+
+  // Values below SUB_BUCKETS nsec are recorded exactly, after which each doubling of magnitude
+  // is split into HALF_SUB_BUCKETS equally-sized buckets
+  static size_t BucketIndex(uint64_t const nsec)
+  {
+    if (nsec < SUB_BUCKETS) return nsec;
+    int const msb   = 63 - __builtin_clzll(nsec);
+    int const shift = msb - SUB_BUCKET_BITS + 1;
+    return SUB_BUCKETS + (shift - 1) * HALF_SUB_BUCKETS + ((nsec >> shift) - HALF_SUB_BUCKETS);
+  }
+
+  // Midpoint of a bucket (in nsec)
+  static double BucketValue(size_t const bucket)
+  {
+    if (bucket < SUB_BUCKETS) return bucket;
+    int      const shift = (bucket - SUB_BUCKETS) / HALF_SUB_BUCKETS + 1;
+    uint64_t const lower = (uint64_t)(HALF_SUB_BUCKETS + (bucket - SUB_BUCKETS) % HALF_SUB_BUCKETS) << shift;
+    return lower + ((uint64_t)1 << shift) / 2.0;
+  }
+
+  std::vector<uint64_t> counts;     // Number of samples per bucket
+  size_t                numSamples;
+  double                mean;
+  double                m2;         // Sum of squared differences from the mean
+  double                minValue;
+  double                maxValue;
+};
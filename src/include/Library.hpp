@@ -0,0 +1,211 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+// Implementation of the library interface (TransferBenchApi.hpp) on top of ExecuteTransfers
+#include "TransferBenchApi.hpp"
+
+namespace TransferBench
+{
+  struct Context::Impl
+  {
+    EnvVars*    ev = nullptr;
+    MemPool     memPool;    // Buffers / streams kept alive between runs of this Context
+    int         testNum = 0;
+    std::string initError;  // Set if the Context could not be constructed, and returned by every Run
+  };
+
+  Context::Context(Config const& config) : impl(new Impl)
+  {
+    if (numa_available() == -1)
+    {
+      impl->initError = "NUMA library not supported. Check to see if libnuma has been installed on this system";
+      return;
+    }
+
+    // Settings are owned by this Context.  Buffers and streams are kept alive between runs unless asked otherwise
+    EnvVars::SettingsSource settings;
+    settings.values        = config.settings;
+    settings.useProcessEnv = config.useProcessEnv;
+    settings.values.insert(std::make_pair("USE_MEM_POOL", "1"));
+
+    // Invalid settings and HIP errors while detecting devices are returned by Run instead of exiting the process
+    throwInputErrors = true;
+    throwRunErrors   = true;
+    try
+    {
+      impl->ev = new EnvVars(settings);
+      if (!SelectGpuIndexing(impl->ev->usePcieIndexing))
+        InputError("USE_PCIE_INDEX must be the same for all Contexts of a process");
+    }
+    catch (std::exception const& e)
+    {
+      delete impl->ev;
+      impl->ev = nullptr;
+      impl->initError = e.what();
+    }
+    throwInputErrors = false;
+    throwRunErrors   = false;
+  }
+
+  Context::~Context()
+  {
+    UseMemPool(&impl->memPool);
+    ReleasePooledResources();
+    UseMemPool(nullptr);
+    delete impl->ev;
+  }
+
+  int Context::NumCpus() const { return impl->ev ? impl->ev->numCpuDevices : 0; }
+  int Context::NumGpus() const { return impl->ev ? impl->ev->numGpuDevices : 0; }
+
+  RunResult Context::Run(std::vector<TransferDesc> const& descs, size_t const numBytes)
+  {
+    RunResult result;
+    if (!impl->ev)
+    {
+      result.error = impl->initError;
+      return result;
+    }
+    EnvVars const& ev = *impl->ev;
+
+    // Invalid inputs are returned in result.error instead of exiting the process (nothing is run)
+    std::vector<::Transfer> transfers(descs.size());
+    throwInputErrors = true;
+    try
+    {
+      if (numBytes % 4)
+        InputError("numBytes (%lu) must be a multiple of 4", numBytes);
+
+      // Descriptors go through the same parsing / checks as Transfers read from a configuration file
+      auto memToken = [](std::vector<MemDevice> const& mems)
+      {
+        std::string token;
+        for (MemDevice const& mem : mems)
+          token += std::string(1, mem.memType) + std::to_string(mem.index);
+        return token.empty() ? std::string("N0") : token;
+      };
+
+      for (int i = 0; i < descs.size(); i++)
+      {
+        TransferDesc const& desc = descs[i];
+        ::Transfer& transfer = transfers[i];
+
+        std::string exeToken = std::string(1, desc.exeType) + std::to_string(desc.exeIndex);
+        if (desc.exeSubIndex != -1) exeToken += "." + std::to_string(desc.exeSubIndex);
+
+        ParseMemType(memToken(desc.srcs), ev.numCpuDevices, ev.numGpuDevices, transfer.srcType, transfer.srcIndex, transfer.srcRank);
+        ParseMemType(memToken(desc.dsts), ev.numCpuDevices, ev.numGpuDevices, transfer.dstType, transfer.dstIndex, transfer.dstRank);
+        ParseExeType(exeToken, ev.numCpuDevices, ev.numGpuDevices, transfer.exeType, transfer.exeIndex, transfer.exeRank,
+                     transfer.exeSubIndex);
+        transfer.numSrcs = (int)transfer.srcType.size();
+        transfer.numDsts = (int)transfer.dstType.size();
+        CheckTransfer(transfer, i+1);
+
+        if (desc.numSubExecs <= 0 && desc.numSubExecs != AUTO_SUBEXECS)
+          InputError("Transfer %d: Number of subExecutors must be greater than 0 or -1 (auto)", i+1);
+        if (desc.numBytes % 4)
+          InputError("Transfer %d: numBytes (%lu) must be a multiple of 4", i+1, desc.numBytes);
+        if (desc.exeSubIndex != -1 && !ev.useHsaDma)
+          InputError("Transfer %d selects an SDMA engine, which requires USE_HSA_DMA=1", i+1);
+        transfer.numSubExecs    = desc.numSubExecs;
+        transfer.numBytes       = desc.numBytes;
+        transfer.numBytesActual = 0;
+      }
+
+      // Look up "auto" numbers of subExecutors from the autotune table
+      ResolveAutoSubExecs(ev, transfers);
+    }
+    catch (std::invalid_argument const& e)
+    {
+      throwInputErrors = false;
+      result.error = e.what();
+      return result;
+    }
+    throwInputErrors = false;
+
+    // Runs of different Contexts are serialized, as they would compete for the same devices (and share process-wide
+    // state such as the autotune table and background loads)
+    static std::mutex runMutex;
+    std::lock_guard<std::mutex> lock(runMutex);
+
+    // Settings that can not be combined with these Transfers, HIP / HSA errors and validation mismatches
+    // (on this thread or on any executor thread) are returned instead of exiting the process
+    double cpuBandwidthGbs = 0;
+    throwInputErrors = true;
+    throwRunErrors   = true;
+    UseMemPool(&impl->memPool);
+    try
+    {
+      result.validationFailed = !ExecuteTransfers(ev, ++impl->testNum, numBytes / sizeof(float), transfers, false,
+                                                  &cpuBandwidthGbs);
+    }
+    catch (std::exception const& e)
+    {
+      result.error = e.what();
+
+      // A failed run leaves its buffers checked out of the pool, so the pool is released for the next run to start
+      // afresh (errors while releasing are dropped, as the first error has already been reported)
+      try
+      {
+        ReleasePooledResources();
+      }
+      catch (std::exception const&)
+      {
+      }
+    }
+    throwInputErrors = false;
+    throwRunErrors   = false;
+    UseMemPool(nullptr);
+    if (!result.error.empty()) return result;
+
+    size_t totalBytes = 0;
+    for (::Transfer const& transfer : transfers)
+    {
+      // The histogram may hold more samples than iterations (each pass of a looping Transfer is a sample)
+      LatencyHistogram const& histogram = transfer.latencyHistogram;
+      size_t const numTimedIterations = transfer.numTimedIterations;
+      bool   const hasSamples         = histogram.Count() > 0;
+
+      TransferResult transferResult;
+      transferResult.numBytes         = transfer.numBytesActual;
+      transferResult.timeMs           = numTimedIterations ? transfer.transferTime / numTimedIterations : 0.0;
+      transferResult.bandwidthGbs     = transferResult.timeMs > 0 ? (transfer.numBytesActual / 1.0E6) / transferResult.timeMs : 0.0;
+      transferResult.minMs            = hasSamples         ? histogram.Min()              : 0.0;
+      transferResult.p50Ms            = hasSamples         ? histogram.Percentile(50.0)   : 0.0;
+      transferResult.p99Ms            = hasSamples         ? histogram.Percentile(99.0)   : 0.0;
+      transferResult.maxMs            = hasSamples         ? histogram.Max()              : 0.0;
+      transferResult.iterationTimesMs = transfer.perIterationTime;
+      result.transfers.push_back(transferResult);
+      totalBytes += transfer.numBytesActual;
+    }
+    result.cpuBandwidthGbs = cpuBandwidthGbs;
+    result.cpuTimeMs       = cpuBandwidthGbs > 0 ? (totalBytes / 1.0E6) / cpuBandwidthGbs : 0.0;
+    return result;
+  }
+
+  int RunCommandLine(int argc, char** argv)
+  {
+    return CommandLineMain(argc, argv);
+  }
+}
@@ -0,0 +1,123 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+// Helper functions for running TransferBench across multiple processes (e.g. one rank per GPU under mpirun/srun)
+// When built without TB_ENABLE_MPI, these reduce to a single process (rank 0 of 1)
+#if defined(TB_ENABLE_MPI)
+#include <mpi.h>
+#endif
+
+void MpInit(int* argc, char*** argv)
+{
+#if defined(TB_ENABLE_MPI)
+  int isInitialized;
+  MPI_Initialized(&isInitialized);
+  if (!isInitialized) MPI_Init(argc, argv);
+#endif
+}
+
+void MpFinalize()
+{
+#if defined(TB_ENABLE_MPI)
+  MPI_Finalize();
+#endif
+}
+
+int MpRank()
+{
+#if defined(TB_ENABLE_MPI)
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return rank;
+#else
+  return 0;
+#endif
+}
+
+int MpNumRanks()
+{
+#if defined(TB_ENABLE_MPI)
+  int numRanks;
+  MPI_Comm_size(MPI_COMM_WORLD, &numRanks);
+  return numRanks;
+#else
+  return 1;
+#endif
+}
+
+void MpBarrier()
+{
+#if defined(TB_ENABLE_MPI)
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+}
+
+// Copy numBytes of data from rank root to all other ranks
+void MpBroadcast(void* data, size_t const numBytes, int const root)
+{
+#if defined(TB_ENABLE_MPI)
+  MPI_Bcast(data, numBytes, MPI_BYTE, root, MPI_COMM_WORLD);
+#endif
+}
+
+// Element-wise sum of values across all ranks
+void MpSum(double* values, int const count)
+{
+#if defined(TB_ENABLE_MPI)
+  MPI_Allreduce(MPI_IN_PLACE, values, count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+}
+
+// Element-wise sum of values across all ranks
+void MpSum(uint64_t* values, int const count)
+{
+#if defined(TB_ENABLE_MPI)
+  MPI_Allreduce(MPI_IN_PLACE, values, count, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+#endif
+}
+
+// Maximum of value across all ranks
+double MpMax(double const value)
+{
+#if defined(TB_ENABLE_MPI)
+  double result;
+  MPI_Allreduce(&value, &result, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  return result;
+#else
+  return value;
+#endif
+}
+
+// Returns true only if value is true on all ranks
+bool MpAll(bool const value)
+{
+#if defined(TB_ENABLE_MPI)
+  int local = value, result;
+  MPI_Allreduce(&local, &result, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD);
+  return result;
+#else
+  return value;
+#endif
+}
@@ -0,0 +1,188 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Version of the layout of records written to RESULTS_FILE
+// Must be incremented whenever existing fields are renamed, removed, or change meaning
+#define RESULTS_SCHEMA_VERSION 1
+
+// Incrementally built JSON object
+class JsonObject
+{
+public:
+  JsonObject& Add(std::string const& key, std::string const& value) { Key(key); AppendValue(value); return *this; }
+  JsonObject& Add(std::string const& key, char const* value)        { return Add(key, std::string(value)); }
+  JsonObject& Add(std::string const& key, bool const value)         { Key(key); body += value ? "true" : "false"; return *this; }
+  JsonObject& Add(std::string const& key, JsonObject const& value)  { Key(key); AppendValue(value); return *this; }
+
+  template <typename T>
+  typename std::enable_if<std::is_arithmetic<T>::value, JsonObject&>::type
+  Add(std::string const& key, T const value) { Key(key); AppendValue(value); return *this; }
+
+  template <typename T>
+  JsonObject& Add(std::string const& key, std::vector<T> const& values)
+  {
+    Key(key);
+    body += '[';
+    for (size_t i = 0; i < values.size(); i++)
+    {
+      if (i) body += ',';
+      AppendValue(values[i]);
+    }
+    body += ']';
+    return *this;
+  }
+
+  // Append all fields of another object to this one
+  JsonObject& Merge(JsonObject const& other)
+  {
+    if (other.body.empty()) return *this;
+    if (!body.empty()) body += ',';
+    body += other.body;
+    return *this;
+  }
+
+  std::string ToString() const { return "{" + body + "}"; }
+
+  static std::string Quote(std::string const& str)
+  {
+    std::string result = "\"";
+    for (unsigned char c : str)
+    {
+      if      (c == '"')  result += "\\\"";
+      else if (c == '\\') result += "\\\\";
+      else if (c == '\n') result += "\\n";
+      else if (c == '\t') result += "\\t";
+      else if (c < 0x20)
+      {
+        char buffer[8];
+        snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+        result += buffer;
+      }
+      else result += c;
+    }
+    return result + "\"";
+  }
+
+private:
+  std::string body;
+
+  void Key(std::string const& key)
+  {
+    if (!body.empty()) body += ',';
+    body += Quote(key) + ':';
+  }
+
+  void AppendValue(std::string const& value) { body += Quote(value); }
+  void AppendValue(JsonObject const& value)  { body += value.ToString(); }
+
+  template <typename T>
+  typename std::enable_if<std::is_arithmetic<T>::value>::type AppendValue(T const value)
+  {
+    if (std::is_floating_point<T>::value)
+    {
+      // JSON has no representation for inf / nan
+      if (!std::isfinite((double)value)) { body += "null"; return; }
+      char buffer[32];
+      snprintf(buffer, sizeof(buffer), "%.9g", (double)value);
+      body += buffer;
+    }
+    else
+      body += std::to_string(value);
+  }
+};
+
+// Streams results as JSON lines to a file, one self-contained record per line
+// Each record is flushed as soon as it is written, so nothing accumulates in memory during long sweeps
+// The first record (type "header") holds the TransferBench version, environment variable settings, and topology
+class ResultsSink
+{
+public:
+  static ResultsSink& Get()
+  {
+    static ResultsSink sink;
+    return sink;
+  }
+
+  ~ResultsSink()
+  {
+    if (fp) fclose(fp);
+  }
+
+  void Open(std::string const& filename, std::string const& version, JsonObject const& topologyInfo)
+  {
+    fp = fopen(filename.c_str(), "w");
+    if (!fp)
+    {
+      printf("[ERROR] Unable to open results file [%s] for writing\n", filename.c_str());
+      exit(1);
+    }
+    tbVersion = version;
+    topology  = topologyInfo;
+  }
+
+  bool IsOpen() const { return fp != NULL; }
+
+  // Environment variables are collected as they are displayed, and written with the header
+  void AddEnvVar(std::string const& name, int const value)         { envVars[name] = std::to_string(value); }
+  void AddEnvVar(std::string const& name, std::string const& value) { envVars[name] = JsonObject::Quote(value); }
+
+  // Write one record of the given type
+  void Write(std::string const& type, JsonObject const& record)
+  {
+    if (!fp) return;
+
+    // Header is written lazily so that it includes env vars displayed by presets
+    if (numRecords == 0)
+    {
+      std::string envStr;
+      for (auto const& envVar : envVars)
+        envStr += (envStr.empty() ? "" : ",") + JsonObject::Quote(envVar.first) + ":" + envVar.second;
+
+      fprintf(fp, "{\"schema\":%d,\"type\":\"header\",\"seq\":0,\"version\":%s,\"env\":{%s},\"topology\":%s}\n",
+              RESULTS_SCHEMA_VERSION, JsonObject::Quote(tbVersion).c_str(), envStr.c_str(),
+              topology.ToString().c_str());
+      numRecords++;
+    }
+
+    JsonObject line;
+    line.Add("schema", RESULTS_SCHEMA_VERSION).Add("type", type).Add("seq", numRecords++).Merge(record);
+    fprintf(fp, "%s\n", line.ToString().c_str());
+    fflush(fp);
+  }
+
+private:
+  FILE*                              fp = NULL;
+  size_t                             numRecords = 0;
+  std::string                        tbVersion;
+  JsonObject                         topology;
+  std::map<std::string, std::string> envVars;   // Env var name to JSON-encoded value
+};
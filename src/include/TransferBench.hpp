@@ -31,9 +31,25 @@ THE SOFTWARE.
 #include <map>
 #include <iostream>
 #include <sstream>
+#include <tuple>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <stdexcept>
 
 #include "Compatibility.hpp"
 
+// Reports invalid input (Transfer definitions / sizes / settings) by printing the error and exiting, or, while
+// throwInputErrors is set (as done by the library), by throwing std::invalid_argument with the message
+extern thread_local bool throwInputErrors;
+[[noreturn]] void InputError(char const* format, ...) __attribute__((format(printf, 1, 2)));
+
+// While set (as done by the library while running Transfers), HIP / HSA errors and other failures while running
+// throw std::runtime_error, and validation mismatches are returned instead of exiting.  ExecuteTransfers passes both
+// flags on to its executor threads, and rethrows their errors once all of them have finished
+extern thread_local bool throwRunErrors;
+[[noreturn]] void RunError(char const* format, ...) __attribute__((format(printf, 1, 2)));
+
 // Helper macro for catching HIP errors
 #define HIP_CALL(cmd)                                                                   \
     do {                                                                                \
@@ -42,17 +58,36 @@ THE SOFTWARE.
         {                                                                               \
             std::cerr << "Encountered HIP error (" << hipGetErrorString(error)          \
                       << ") at line " << __LINE__ << " in file " << __FILE__ << "\n";   \
+            if (throwRunErrors) RunError("HIP error (%s)", hipGetErrorString(error));   \
             exit(-1);                                                                   \
         }                                                                               \
     } while (0)
 
 #include "EnvVars.hpp"
+#include "Baseline.hpp"
+#include "GpuCounters.hpp"
+#include "LatencyHistogram.hpp"
+#include "MultiProcess.hpp"
 
 // Simple configuration parameters
 size_t const DEFAULT_BYTES_PER_TRANSFER = (1<<26);  // Amount of data transferred per Transfer
 
 #define MAX_LINE_LEN 32768
 
+// Maximum number of pages of a CPU allocation whose NUMA placement is queried (evenly sampled)
+#define MAX_CHECKED_PAGES (1<<16)
+
+// Maximum total size of the host reference buffers cached across Tests (shared by all threads)
+#define MAX_REFERENCE_CACHE_BYTES (1ULL<<32)
+
+// Sweep preset limits
+#define MAX_PRIORITIZED_COMBOS  (1<<20)  // Max # of combinations of one size to sort by contention score
+#define NUM_PRIORITY_CANDIDATES 8        // # of random combinations considered per random sweep test
+#define MAX_SWEEP_DUPLICATES    1000     // # of already tested random combinations drawn before giving up
+
+// Number of copies of the subExecutor parameters kept per GFX executor (see MAX_ASYNC_PARAM_SLICES)
+inline int NumParamSlices(EnvVars const& ev) { return ev.useAsyncLaunch ? std::min(ev.numIterations, MAX_ASYNC_PARAM_SLICES) : 1; }
+
 // Different src/dst memory types supported
 typedef enum
 {
@@ -62,21 +97,51 @@ typedef enum
   MEM_GPU_FINE     = 3, // Fine-grained global GPU memory
   MEM_CPU_UNPINNED = 4, // Unpinned CPU memory
   MEM_NULL         = 5, // NULL memory - used for empty
+  MEM_CPU_HUGE     = 6, // Huge-page CPU memory (registered with HIP)
+  MEM_CPU_INTERLV  = 7, // Coarse-grained pinned CPU memory interleaved across all NUMA nodes
+  MEM_CPU_USER     = 8, // First-touched user CPU memory (registered with HIP)
+  MEM_MANAGED      = 9, // Managed (unified) memory associated with a GPU
 } MemType;
 
 typedef enum
 {
   EXE_CPU          = 0, // CPU executor              (subExecutor = CPU thread)
   EXE_GPU_GFX      = 1, // GPU kernel-based executor (subExecutor = threadblock/CU)
-  EXE_GPU_DMA      = 2, // GPU SDMA-based executor   (subExecutor = streams)
+  EXE_GPU_DMA      = 2, // GPU SDMA-based executor   (subExecutor = streams, or SDMA engines with USE_HSA_DMA)
 } ExeType;
 
-bool IsGpuType(MemType m) { return (m == MEM_GPU || m == MEM_GPU_FINE); }
-bool IsCpuType(MemType m) { return (m == MEM_CPU || m == MEM_CPU_FINE || m == MEM_CPU_UNPINNED); };
+bool IsGpuType(MemType m) { return (m == MEM_GPU || m == MEM_GPU_FINE || m == MEM_MANAGED); }
+bool IsCpuType(MemType m) { return (m == MEM_CPU || m == MEM_CPU_FINE || m == MEM_CPU_UNPINNED ||
+                                     m == MEM_CPU_HUGE || m == MEM_CPU_INTERLV || m == MEM_CPU_USER); };
 bool IsGpuType(ExeType e) { return (e == EXE_GPU_GFX || e == EXE_GPU_DMA); };
 bool IsCpuType(ExeType e) { return (e == EXE_CPU); };
 
-char const MemTypeStr[7] = "CGBFUN";
+// Collective communication patterns available as presets
+typedef enum
+{
+  COLL_ALLREDUCE     = 0, // Ring all-reduce (ring reduce-scatter followed by ring all-gather)
+  COLL_REDUCESCATTER = 1, // Ring reduce-scatter
+  COLL_ALLGATHER     = 2, // Ring all-gather
+  COLL_BROADCAST     = 3, // Pipelined binary-tree broadcast from the first GPU in the ring order
+  NUM_COLL_TYPES     = 4
+} CollType;
+char const CollTypeName[NUM_COLL_TYPES][16] = {"allreduce", "reducescatter", "allgather", "broadcast"};
+
+// Number of subExecutors that is looked up from the autotune table (requested via "auto")
+#define AUTO_SUBEXECS -1
+
+// Best settings found by the autotune preset for one link class
+struct TuningEntry
+{
+  int    numSubExecs;    // Number of subExecutors
+  int    gpuKernel;      // GPU_KERNEL
+  int    blockSize;      // BLOCK_SIZE
+  int    blockBytes;     // BLOCK_BYTES
+  int    useXccFilter;   // USE_XCC_FILTER
+  double bandwidthGbs;   // Bandwidth achieved with these settings
+};
+
+char const MemTypeStr[11] = "CGBFUNHIRM";
 char const ExeTypeStr[4] = "CGD";
 char const ExeTypeName[3][4] = {"CPU", "GPU", "DMA"};
 
@@ -84,16 +149,14 @@ MemType inline CharToMemType(char const c)
 {
   char const* val = strchr(MemTypeStr, toupper(c));
   if (val) return (MemType)(val - MemTypeStr);
-  printf("[ERROR] Unexpected memory type (%c)\n", c);
-  exit(1);
+  InputError("Unexpected memory type (%c)", c);
 }
 
 ExeType inline CharToExeType(char const c)
 {
   char const* val = strchr(ExeTypeStr, toupper(c));
   if (val) return (ExeType)(val - ExeTypeStr);
-  printf("[ERROR] Unexpected executor type (%c)\n", c);
-  exit(1);
+  InputError("Unexpected executor type (%c)", c);
 }
 
 // Each Transfer performs reads from source memory location(s), sums them (if multiple sources are specified)
@@ -103,27 +166,46 @@ struct Transfer
   int                        transferIndex;      // Transfer identifier (within a Test)
   ExeType                    exeType;            // Transfer executor type
   int                        exeIndex;           // Executor index (NUMA node for CPU / device ID for GPU)
+  int                        exeRank = 0;        // Rank of the process that executes this Transfer
+  int                        exeSubIndex = -1;   // SDMA engine for DMA executors with USE_HSA_DMA (-1 = any)
   int                        numSubExecs;        // Number of subExecutors to use for this Transfer
   size_t                     numBytes;           // # of bytes requested to Transfer (may be 0 to fallback to default)
   size_t                     numBytesActual;     // Actual number of bytes to copy
   double                     transferTime;       // Time taken in milliseconds
+  size_t                     numTimedIterations = 0; // Number of timed iterations transferTime accumulates over
+  bool                       isLooping = false;  // Repeat until all other Transfers in the Test complete
+  size_t                     numLoopPasses = 0;  // Number of timed passes counted for a looping Transfer
 
   int                        numSrcs;            // Number of sources
   std::vector<MemType>       srcType;            // Source memory types
   std::vector<int>           srcIndex;           // Source device indice
+  std::vector<int>           srcRank;            // Rank of the process that owns each source (defaults to 0)
   std::vector<float*>        srcMem;             // Source memory
 
   int                        numDsts;            // Number of destinations
   std::vector<MemType>       dstType;            // Destination memory type
   std::vector<int>           dstIndex;           // Destination device index
+  std::vector<int>           dstRank;            // Rank of the process that owns each destination (defaults to 0)
   std::vector<float*>        dstMem;             // Destination memory
 
   std::vector<SubExecParam>  subExecParam;       // Defines subarrays assigned to each threadblock
   SubExecParam*              subExecParamGpuPtr; // Pointer to GPU copy of subExecParam
   std::vector<int>           subExecIdx;         // Indicies into subExecParamGpu
+  int                        subExecOffset;      // Index of first subExecutor of this Transfer within its executor
 
   std::vector<double>        perIterationTime;   // Per-iteration timing
+  LatencyHistogram           latencyHistogram;   // Distribution of per-iteration timing
   std::vector<std::set<std::pair<int,int>>> perIterationCUs; // Per-iteration CU usage
+  std::map<std::string, double> gpuCounters;     // Hardware counter values per timed iteration (GPU_COUNTERS)
+  std::vector<size_t>        numChunksPerSubExec; // Chunks processed per subExecutor over timed iterations (work-stealing kernel)
+
+#if !defined(__NVCC__)
+  // For DMA executors with USE_HSA_DMA (one stripe per subExecutor)
+  hsa_agent_t                dmaSrcAgent;        // HSA agent owning source memory
+  hsa_agent_t                dmaDstAgent;        // HSA agent owning destination memory
+  std::vector<uint32_t>      dmaEngineIds;       // SDMA engine ID (bitmask) used by each stripe
+  std::vector<hsa_signal_t>  dmaSignals;         // Completion signal of each stripe
+#endif
 
   // Prepares src/dst subarray pointers for each SubExecutor
   void PrepareSubExecParams(EnvVars const& ev);
@@ -131,11 +213,24 @@ struct Transfer
   // Prepare source arrays with input data
   bool PrepareSrc(EnvVars const& ev);
 
-  // Validate that destination data contains expected results
-  void ValidateDst(EnvVars const& ev);
+  // Validate that destination data contains expected results (returns false on mismatch)
+  bool ValidateDst(EnvVars const& ev);
+
+  // Returns (cached) reference data of at least numBytesActual bytes (bufferIdx < 0 for destination buffers)
+  std::shared_ptr<std::vector<float> const> PrepareReference(EnvVars const& ev, int bufferIdx);
+
+  // Validate a GPU-resident buffer in place on its device (bufferIdx < 0 for destination buffers)
+  // Returns the number of mismatching elements, and the float index of the first one in firstMismatch
+  size_t ValidateOnGpu(EnvVars const& ev, float const* ptr, int deviceIdx, int bufferIdx, size_t& firstMismatch);
 
-  // Prepare reference buffers
-  void PrepareReference(EnvVars const& ev, std::vector<float>& buffer, int bufferIdx);
+  // Rank of the process owning each source / destination
+  int SrcRank(int i) const { return i < srcRank.size() ? srcRank[i] : 0; }
+  int DstRank(int i) const { return i < dstRank.size() ? dstRank[i] : 0; }
+
+  // Device through which GPU source / destination memory is accessed
+  // (the executing GPU if the memory belongs to a different rank)
+  int SrcDevice(int i) const;
+  int DstDevice(int i) const;
 
   // String representation functions
   std::string SrcToStr() const;
@@ -147,54 +242,209 @@ struct ExecutorInfo
   std::vector<Transfer*>   transfers;        // Transfers to execute
   size_t                   totalBytes;       // Total bytes this executor transfers
   int                      totalSubExecs;    // Total number of subExecutors to use
+  int                      numSubExecSlots;  // Number of subExecutor parameters per copy (includes padding)
 
   // For GPU-Executors
   SubExecParam*            subExecParamGpu;  // GPU copy of subExecutor parameters
+  unsigned long long*      chunkCountersGpu; // Chunk counters per Transfer (work-stealing kernel)
   std::vector<hipStream_t> streams;
   std::vector<hipEvent_t>  startEvents;
   std::vector<hipEvent_t>  stopEvents;
+  std::vector<std::vector<hipGraphExec_t>> graphExecs; // Instantiated graphs per stream / parameter copy
 
   // Results
   double totalTime;
+  LatencyHistogram latencyHistogram;         // Distribution of per-iteration executor timing
+};
+
+// Background load (BG_LOAD) run on a GPU alongside the Transfers of a Test
+struct BackgroundLoad
+{
+  int               deviceIdx;        // HIP device the load runs on
+  int               numBlocks;        // Number of persistent threadblocks
+  size_t            numPacksPerBlock; // float4s copied by each threadblock per pass (memory-bound load only)
+  hipStream_t       stream;           // Blocking w.r.t. the null stream when created with BG_CU_MASK
+  MemType           hostMemType;      // Memory type of stopFlag / results
+  int*              stopFlag;         // Host memory polled by the background kernel
+  BackgroundResult* results;          // Per-threadblock results, written to host memory by the background kernel
+  float4*           srcMem;
+  float4*           dstMem;
 };
 
 typedef std::pair<ExeType, int> Executor;
 typedef std::map<Executor, ExecutorInfo> TransferMap;
 
+// Memory allocations are pooled by (memory type, device index, size class)
+typedef std::tuple<MemType, int, size_t> MemPoolKey;
+
+// Device buffers used by VALIDATE_ON_GPU, and the stream used for validation, allocated once per GPU device
+struct ValidationScratch
+{
+  hipStream_t         stream     = NULL; // Non-blocking, so that validation never waits on a background load
+  unsigned long long* devResults = NULL; // Mismatch count and index of first mismatch
+  float*              devPattern = NULL; // Device copy of the fill pattern
+  std::vector<float>  pattern;           // Fill pattern currently held in devPattern
+};
+
+// Resources that are kept alive across Tests when USE_MEM_POOL is enabled.  Each libtransferbench Context owns its
+// own pool, and all accesses to a pool are made while holding its mutex
+struct MemPool
+{
+  std::mutex                               mutex;
+  std::map<MemPoolKey, std::vector<void*>> freeBuffers;  // Allocations available for re-use
+  std::map<void*, MemPoolKey>              usedBuffers;  // Allocations currently in use
+  std::map<int, std::vector<hipStream_t>>  streams;      // Streams per GPU device
+  std::map<int, std::vector<hipEvent_t>>   startEvents;  // Start events per GPU device
+  std::map<int, std::vector<hipEvent_t>>   stopEvents;   // Stop events per GPU device
+  std::map<int, ValidationScratch>         validation;   // VALIDATE_ON_GPU scratch per GPU device (always kept)
+};
+
+// Runs TransferBench as invoked from the command line, returning the process exit code
+int CommandLineMain(int argc, char **argv);
+// Runs the Tests / presets requested on the command line once multi-process support has been initialized
+int RunCommandLineTests(int argc, char **argv);
+
 // Display usage instructions
 void DisplayUsage(char const* cmdName);
 
 // Display detected GPU topology / CPU numa nodes
 void DisplayTopology(bool const outputToCsv);
+JsonObject GetTopologyJson(EnvVars const& ev);
+// Compare the results of one Test against the baseline.  Returns true if the Test should be re-run
+bool CheckBaseline(EnvVars const& ev, int const testNum, std::vector<Transfer> const& transfers,
+                   size_t const numTimedIterations);
+// Write the results of one Test to the results file
+void ReportTestResults(EnvVars const& ev, int const testNum, std::vector<Transfer> const& transfers,
+                       size_t const numTimedIterations, double const cpuTimeMsec, double const cpuBandwidthGbs,
+                       double const coldCpuTimeMsec, std::map<int, double> const& backgroundThroughput);
 
 // Build array of test sizes based on sampling factor
 void PopulateTestSizes(size_t const numBytesPerTransfer, int const samplingFactor,
                        std::vector<size_t>& valuesofN);
 
 void ParseMemType(std::string const& token, int const numCpus, int const numGpus,
-                  std::vector<MemType>& memType, std::vector<int>& memIndex);
+                  std::vector<MemType>& memType, std::vector<int>& memIndex, std::vector<int>& memRank);
 void ParseExeType(std::string const& token, int const numCpus, int const numGpus,
-                  ExeType& exeType, int& exeIndex);
+                  ExeType& exeType, int& exeIndex, int& exeRank, int& exeSubIndex);
 
+void CheckTransfer(Transfer const& transfer, int const transferNum);
 void ParseTransfers(char* line, int numCpus, int numGpus,
                     std::vector<Transfer>& transfers);
 
-void ExecuteTransfers(EnvVars const& ev, int const testNum, size_t const N,
+// Returns false if any source or destination failed validation
+bool ExecuteTransfers(EnvVars const& ev, int const testNum, size_t const N,
                       std::vector<Transfer>& transfers, bool verbose = true,
                       double* totalBandwidthCpu = nullptr);
+// Exits on all ranks if destination validation failed on any of them (unless CONTINUE_ON_ERROR or throwRunErrors
+// is set), otherwise returns whether all ranks validated correctly
+bool CheckDstCorrect(EnvVars const& ev, bool const isDstCorrect);
+
+// Allocate / map memory that is owned by a different rank than the one executing the Transfer
+void ExchangeRemoteMemory(EnvVars const& ev, size_t const N, std::vector<Transfer>& transfers,
+                          std::vector<std::tuple<MemType, float*, size_t>>& exportedMem);
 
 void EnablePeerAccess(int const deviceId, int const peerDeviceId);
-void AllocateMemory(MemType memType, int devIndex, size_t numBytes, void** memPtr);
+void AllocateMemory(EnvVars const& ev, MemType memType, int devIndex, size_t numBytes, void** memPtr);
 void DeallocateMemory(MemType memType, void* memPtr, size_t const size = 0);
 void CheckPages(char* byteArray, size_t numBytes, int targetId);
-void RunTransfer(EnvVars const& ev, int const iteration, ExecutorInfo& exeInfo, int const transferIdx);
+// Apply MANAGED_PREFETCH placement to any managed memory used by a Transfer
+void PrefetchManagedMemory(EnvVars const& ev, Transfer const& transfer);
+
+// Pooled variants of memory / stream allocation (fall back to direct allocation if USE_MEM_POOL is disabled)
+void   AddHugePageMapping(void* memPtr, size_t const mappedBytes);
+size_t TakeHugePageMapping(void* memPtr);
+// Returns the pool selected by UseMemPool on the calling thread (e.g. that of a libtransferbench Context), or
+// otherwise the pool of the process (used by the command-line tool)
+MemPool& GetMemPool();
+void UseMemPool(MemPool* memPool);
+size_t GetSizeClass(size_t const numBytes);
+void AcquireMemory(EnvVars const& ev, MemType memType, int devIndex, size_t numBytes, void** memPtr);
+void ReleaseMemory(EnvVars const& ev, MemType memType, void* memPtr, size_t const numBytes);
+void AcquireStreams(EnvVars const& ev, int const deviceIdx, int const numStreams, ExecutorInfo& exeInfo);
+void ReleaseStreams(EnvVars const& ev, int const deviceIdx, ExecutorInfo& exeInfo);
+void ReleasePooledResources();
+
+// Persistent pinned CPU worker threads per NUMA node
+class CpuThreadPool;
+CpuThreadPool& GetCpuThreadPool(EnvVars const& ev, int const numaNode);
+// With looping Transfers, numPending counts Transfers that have not completed their first pass, and the thread that
+// completes the last of them records the time in pendingDoneTime
+void RunTransfer(EnvVars const& ev, int const iteration, ExecutorInfo& exeInfo, int const transferIdx,
+                 std::atomic<int>* numPending = nullptr,
+                 std::chrono::high_resolution_clock::time_point* pendingDoneTime = nullptr);
+void RunTransferPass(EnvVars const& ev, int const iteration, ExecutorInfo& exeInfo, int const transferIdx);
+void RunTransferAsync(EnvVars const& ev, int const firstIteration, int const numIterations,
+                      ExecutorInfo& exeInfo, int const transferIdx);
+void LaunchGfxTransfer(EnvVars const& ev, ExecutorInfo& exeInfo, int const transferIdx, int const slice,
+                       hipEvent_t startEvent, hipEvent_t stopEvent);
+void LaunchDmaTransfer(ExecutorInfo& exeInfo, int const transferIdx, hipEvent_t startEvent, hipEvent_t stopEvent);
+void LaunchGpuTransfer(EnvVars const& ev, ExecutorInfo& exeInfo, int const transferIdx, int const slice,
+                       hipEvent_t startEvent, hipEvent_t stopEvent);
+void CaptureGraphs(EnvVars const& ev, ExeType const exeType, int const exeIndex, ExecutorInfo& exeInfo);
+void DestroyGraphs(ExecutorInfo& exeInfo);
+void RecordGfxTiming(EnvVars const& ev, ExecutorInfo& exeInfo, int const transferIdx, int const slice,
+                     hipEvent_t startEvent, hipEvent_t stopEvent);
+void RecordDmaTiming(EnvVars const& ev, ExecutorInfo& exeInfo, int const transferIdx,
+                     hipEvent_t startEvent, hipEvent_t stopEvent);
+// Assign SDMA engines and signals to a DMA Transfer executed via HSA (nextEngine rotates engines per executor)
+void PrepareHsaDmaTransfer(Transfer& transfer, int& nextEngine);
+void ReleaseHsaDmaTransfer(Transfer& transfer);
+// Run one iteration of a DMA Transfer striped across its SDMA engines
+void RunHsaDmaTransfer(EnvVars const& ev, int const iteration, Transfer* transfer);
 void RunPeerToPeerBenchmarks(EnvVars const& ev, size_t N);
 void RunScalingBenchmark(EnvVars const& ev, size_t N, int const exeIndex, int const maxSubExecs);
 void RunSweepPreset(EnvVars const& ev, size_t const numBytesPerTransfer, int const numGpuSubExec, int const numCpuSubExec, bool const isRandom);
 void RunAllToAllBenchmark(EnvVars const& ev, size_t const numBytesPerTransfer, int const numSubExecs);
+void RunCollectiveBenchmark(EnvVars const& ev, size_t const numBytes, int const numSubExecs, CollType const collType);
+void RunPipelineBenchmark(EnvVars const& ev, size_t const numBytes);
+void RunContentionBenchmark(EnvVars const& ev, size_t const N);
+void RunAutotuneBenchmark(EnvVars const& ev, size_t const N, int const maxSubExecs);
+// Returns false if any link falls short of its expected bandwidth, or the time limit prevented some checks
+bool RunHealthcheckPreset(EnvVars const& ev, size_t const N);
+void RunLatencyBenchmark(EnvVars const& ev, size_t const numBytes);
+
+// Link class (e.g. XGMI-1, HOST, LOCAL) between a Transfer's executor and the memory it accesses
+std::string GetLinkClass(Transfer const& transfer);
+// Replace "auto" #SubExecs with values from the autotune table
+void ResolveAutoSubExecs(EnvVars const& ev, std::vector<Transfer>& transfers);
 
 std::string GetLinkTypeDesc(uint32_t linkType, uint32_t hopCount);
 
+// GPU index remapping (USE_PCIE_INDEX) is shared by the whole process, and is fixed by the first EnvVars that selects
+// it (or by the process environment if RemappedIndex is used first).  Returns false if a different one is already fixed
+bool SelectGpuIndexing(int const usePcieIndexing);
 int RemappedIndex(int const origIdx, bool const isCpuType);
+inline size_t RoundUp(size_t const value, size_t const multiple) { return (value + multiple - 1) / multiple * multiple; }
 void LogTransfers(FILE *fp, int const testNum, std::vector<Transfer> const& transfers);
 std::string PtrVectorToStr(std::vector<float*> const& strVector, int const initOffset);
+// Latency statistics are reported as p50, p90, p99, p99.9, max and stddev (msec)
+#define NUM_LATENCY_STATS 6
+void GetLatencyStats(LatencyHistogram const& histogram, double* stats);
+// "Aggregate" labels a histogram merged from the samples of several Transfers (not an executor-level measurement)
+void PrintLatencyStats(LatencyHistogram const& histogram, char const* label = "Percentiles");
+void PrintLatencyStatValues(double const* stats, char const* label = "Percentiles");
+// Display hardware counter values (GPU_COUNTERS) of a Transfer
+void PrintGpuCounters(std::map<std::string, double> const& gpuCounters);
+void PrintChunkStats(std::vector<size_t> const& numChunksPerSubExec, size_t const numTimedIterations);
+
+// Open SAMPLE_FILE for one Test (NULL if not set).  The caller closes it once the Test completes
+FILE* OpenSampleFile(EnvVars const& ev);
+// Report per-Transfer bandwidth over one sampling window of timed iterations (also written to sampleFp if not NULL)
+void ReportSampleWindow(EnvVars const& ev, FILE* sampleFp, int const testNum, int const windowIdx,
+                        double const startSec, double const stopSec, size_t const numIterations,
+                        std::map<int, Transfer*> const& transferList,
+                        std::map<int, double>& windowStartTimes, bool const verbose);
+// Current shader clock (MHz) and power (W) of a GPU, or -1 if unavailable
+void GetGpuClockAndPower(int const deviceIdx, int& clockMhz, double& powerW);
+
+// Launch / stop the background load on a GPU.  StopBackgroundLoad returns its throughput (TFLOP/s or GB/s)
+void StartBackgroundLoad(EnvVars const& ev, int const deviceIdx, BackgroundLoad& load);
+double StopBackgroundLoad(EnvVars const& ev, BackgroundLoad& load);
+// Throughput of the background load when running alone on a GPU (measured once per GPU)
+double GetSoloBackgroundThroughput(EnvVars const& ev, int const deviceIdx);
+// HIP devices that currently have a background load running (which must not receive null-stream work)
+std::set<int>& GetBackgroundLoadDevices();
+// Non-blocking stream used to prepare / validate memory on a GPU device (created once per device)
+hipStream_t GetValidationStream(int const deviceIdx);
+std::string LatencyStatsCsv(EnvVars const& ev, LatencyHistogram const* histogram);
+std::string LatencyStatValuesCsv(EnvVars const& ev, double const* stats);
@@ -0,0 +1,134 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+// Public interface for using TransferBench as a library (libtransferbench)
+// This header is self-contained, and does not require HIP to be included by callers
+//
+// Example:
+//   TransferBench::Config config;
+//   config.Set("NUM_ITERATIONS", 20).Set("USE_SINGLE_STREAM", 1);
+//   TransferBench::Context context(config);
+//
+//   TransferBench::TransferDesc desc;
+//   desc.srcs = {{'G', 0}};  desc.exeType = 'G';  desc.exeIndex = 0;  desc.dsts = {{'G', 1}};  desc.numSubExecs = 8;
+//   TransferBench::RunResult result = context.Run({desc}, 1 << 26);
+//
+//   if (!result.error.empty()) printf("Rejected: %s\n", result.error.c_str());
+//
+// NOTE: Errors are returned in RunResult::error instead of terminating the host process:
+//       - Invalid configurations (Config settings, or a missing libnuma) when constructing the Context, by every Run
+//       - Invalid TransferDescs / sizes, and settings that can not be combined with them (e.g. looping Transfers with
+//         USE_ASYNC_LAUNCH, or an SDMA engine that is not available)
+//       - HIP / HSA errors and host allocation failures, including those raised on executor threads
+//       Data mismatches are returned in RunResult::validationFailed.  After an error during a run, the buffers and
+//       streams pooled by the Context are released and the next run allocates them again (streams / HSA signals
+//       that were checked out by the failed run itself are not reclaimed)
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace TransferBench
+{
+  // Run configuration.  Settings are named after the environment variables of the command-line tool
+  // (e.g. "NUM_ITERATIONS", "BLOCK_SIZE", "USE_HSA_DMA"), and any setting that is not given uses its default
+  struct Config
+  {
+    std::map<std::string, std::string> settings;
+    bool useProcessEnv = false; // Read settings that are not given from the process environment
+
+    Config& Set(std::string const& name, std::string const& value) { settings[name] = value; return *this; }
+    Config& Set(std::string const& name, char const* value)        { settings[name] = value; return *this; }
+    Config& Set(std::string const& name, long long const value)    { settings[name] = std::to_string(value); return *this; }
+  };
+
+  // Memory location: memType is one of the memory type characters of the command line (C, G, B, F, U, N, H, I, R, M)
+  struct MemDevice
+  {
+    char memType;
+    int  index;
+  };
+
+  // Describes one Transfer, equivalent to a (SRC EXE DST #SEs #Bytes) entry of a configuration file
+  struct TransferDesc
+  {
+    std::vector<MemDevice> srcs;              // Sources (none for a memset)
+    char                   exeType = 'G';     // Executor: C (CPU), G (GPU GFX) or D (GPU DMA)
+    int                    exeIndex = 0;      // Executor device index
+    int                    exeSubIndex = -1;  // SDMA engine for DMA executors with USE_HSA_DMA (-1 = any)
+    std::vector<MemDevice> dsts;              // Destinations (none for a read-only Transfer)
+    int                    numSubExecs = 1;   // Number of subExecutors (-1 to look up from AUTOTUNE_FILE)
+    size_t                 numBytes = 0;      // Bytes to transfer (0 to use the size passed to Run)
+  };
+
+  struct TransferResult
+  {
+    size_t              numBytes;          // Bytes actually transferred
+    double              timeMs;            // Mean duration over timed iterations
+    double              bandwidthGbs;      // Bandwidth based on mean duration
+    double              minMs;             // Fastest timed iteration
+    double              p50Ms;             // Median timed iteration
+    double              p99Ms;             // 99th percentile timed iteration
+    double              maxMs;             // Slowest timed iteration
+    std::vector<double> iterationTimesMs;  // Per-iteration durations (only collected with SHOW_ITERATIONS)
+  };
+
+  struct RunResult
+  {
+    std::string                 error;               // Empty on success, otherwise why the Transfers were not run / completed
+    bool                        validationFailed = false; // Set if source or destination data did not match the expected values
+    double                      cpuTimeMs = 0;       // Wall-clock time of all Transfers per iteration, as seen by the CPU
+    double                      cpuBandwidthGbs = 0; // Aggregate bandwidth of all Transfers, as seen by the CPU
+    std::vector<TransferResult> transfers;           // Results in the same order as the TransferDescs
+  };
+
+  // Detected devices and configuration, along with the buffers / streams that are reused across runs
+  // (USE_MEM_POOL is enabled unless set explicitly).  Each Context owns its settings and pool, so several may exist
+  // at the same time (with the same USE_PCIE_INDEX), but runs of different Contexts are executed one at a time
+  class Context
+  {
+  public:
+    explicit Context(Config const& config = Config());
+    ~Context();
+    Context(Context const&) = delete;
+    Context& operator=(Context const&) = delete;
+
+    int NumCpus() const;   // Number of CPU (NUMA node) devices
+    int NumGpus() const;   // Number of GPU devices
+
+    // Execute a set of Transfers simultaneously, returning their timing
+    RunResult Run(std::vector<TransferDesc> const& transfers, size_t const numBytes = (1 << 26));
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+  };
+
+  // Runs TransferBench as if invoked from the command line with the given arguments, and returns the exit code the
+  // command-line tool would have exited with.  Unlike Context::Run, invalid Transfers / configurations, data mismatches
+  // (unless CONTINUE_ON_ERROR=1) and HIP errors still terminate the process
+  int RunCommandLine(int argc, char** argv);
+}